@@ -509,6 +509,10 @@ Amr::InitAmr ()
 
     loadbalance_max_fac = 1.5;
     pp.query("loadbalance_max_fac", loadbalance_max_fac);
+
+    pp.queryAdd("async_level_tasks", async_level_tasks);
+
+    pp.queryAdd("cache_derived", cache_derived);
 }
 
 int
@@ -722,6 +726,8 @@ Amr::deleteDeriveSmallPlotVar (const std::string& name)
 
 Amr::~Amr ()
 {
+    finishAllLevelTasks();
+
     levelbld->variableCleanUp();
 
     Amr::Finalize();
@@ -918,6 +924,8 @@ Amr::writeSmallPlotFile ()
 void
 Amr::writePlotFileDoit (std::string const& pltfile, bool regular)
 {
+    finishAllLevelTasks();
+
     auto dPlotFileTime0 = amrex::second();
 
     int max_level_to_plot = std::min(plot_max_level, finest_level);
@@ -1349,6 +1357,7 @@ Amr::FinalizeInit (Real              strt_time,
     for(int lev(0); lev <= finest_level; ++lev) {
         amr_level[lev]->post_init(stop_time);
     }
+    clearDerivedCaches();
 
     if (ParallelDescriptor::IOProcessor())
     {
@@ -1587,6 +1596,7 @@ Amr::restart (const std::string& filename)
        for (int lev = 0; lev <= finest_level; lev++) {
            amr_level[lev]->post_restart();
        }
+       clearDerivedCaches();
 
     } else {
 
@@ -1655,6 +1665,7 @@ Amr::restart (const std::string& filename)
        for (int lev = 0; lev <= new_finest_level; lev++) {
            amr_level[lev]->post_restart();
        }
+       clearDerivedCaches();
     }
 
     // Old checkpoints do not store isPeriodic.
@@ -1707,6 +1718,8 @@ Amr::checkPoint ()
     BL_PROFILE_REGION_START("Amr::checkPoint()");
     BL_PROFILE("Amr::checkPoint()");
 
+    finishAllLevelTasks();
+
     VisMF::SetNOutFiles(checkpoint_nfiles);
     //
     // In checkpoint files always write out FABs in NATIVE format.
@@ -2024,6 +2037,10 @@ Amr::timeStep (int  level,
     Real dt_new = amr_level[level]->advance(time,dt_level[level],iteration,niter);
     BL_PROFILE_REGION_STOP("amr_level.advance");
 
+    // The advance has modified the state that the derived data of this
+    // level and, through FillPatch, of the finer levels depend on.
+    clearDerivedCaches();
+
     dt_min[level] = iteration == 1 ? dt_new : std::min(dt_min[level],dt_new);
 
     level_steps[level]++;
@@ -2078,12 +2095,60 @@ Amr::timeStep (int  level,
         }
     }
 
+    finishLevelTasks(level);
+
     amr_level[level]->post_timestep(iteration);
 
+    // post_timestep may have modified the state (e.g., reflux and average down).
+    clearDerivedCaches();
+
     // Set this back to negative so we know whether we are in fact in this routine
     which_level_being_advanced = -1;
 }
 
+void
+Amr::submitLevelTask (int lev, std::function<void()>&& f)
+{
+    if (async_level_tasks) {
+        if (level_task_thread.size() <= lev) {
+            level_task_thread.resize(lev+1);
+        }
+        if (!level_task_thread[lev]) {
+            level_task_thread[lev] = std::make_unique<BackgroundThread>();
+        }
+        level_task_thread[lev]->Submit(std::move(f));
+    } else {
+        f();
+    }
+}
+
+void
+Amr::finishLevelTasks (int lev)
+{
+    if (lev < level_task_thread.size() && level_task_thread[lev]) {
+        BL_PROFILE("Amr::finishLevelTasks()");
+        level_task_thread[lev]->Finish();
+    }
+}
+
+void
+Amr::finishAllLevelTasks ()
+{
+    for (int lev = 0; lev < level_task_thread.size(); ++lev) {
+        finishLevelTasks(lev);
+    }
+}
+
+void
+Amr::clearDerivedCaches ()
+{
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        if (amr_level[lev]) {
+            amr_level[lev]->clearDerivedCache();
+        }
+    }
+}
+
 Real
 Amr::coarseTimeStepDt (Real stop_time)
 {
@@ -2132,6 +2197,8 @@ Amr::coarseTimeStep (Real stop_time)
     timeStep(0,cumtime,1,1,stop_time);
     BL_PROFILE_REGION_STOP(stepName.str());
 
+    finishAllLevelTasks();
+
     cumtime += dt_level[0];
 
     // sync up statedata time
@@ -2575,6 +2642,10 @@ Amr::regrid (int  lbase,
 
     if (lbase > std::min(finest_level,max_level-1)) { return; }
 
+    for (int lev = lbase; lev <= finest_level; ++lev) {
+        finishLevelTasks(lev);
+    }
+
     if (verbose > 0) {
         amrex::Print() << "Now regridding at level lbase = " << lbase << "\n";
     }
@@ -2809,6 +2880,8 @@ Amr::InstallNewDistributionMap (int lev, const DistributionMapping& newdm)
 {
     BL_PROFILE("InstallNewDistributionMap()");
 
+    finishLevelTasks(lev);
+
     AmrLevel* a = (*levelbld)(*this,lev,Geom(lev),boxArray(lev),newdm,cumtime);
     a->init(*amr_level[lev]);
     amr_level[lev].reset(a);
@@ -481,6 +481,7 @@ AmrLevel::setTimeLevel (Real time,
     {
         state[k].setTimeLevel(time,dt_old,dt_new);
     }
+    clearDerivedCache();
 }
 
 bool
@@ -599,6 +600,7 @@ AmrLevel::reset ()
     {
         state[i].reset();
     }
+    clearDerivedCache();
 }
 
 MultiFab&
@@ -1617,6 +1619,52 @@ AmrLevel::derive (const std::string& name, Real time, int ngrow)
     BL_PROFILE("AmrLevel::derive()");
     BL_ASSERT(ngrow >= 0);
 
+    if (parent != nullptr && parent->cacheDerived()) {
+        auto cached = cachedDerive(name, time, ngrow);
+        auto mf = std::make_unique<MultiFab>(cached->boxArray(), dmap, cached->nComp(),
+                                             ngrow, MFInfo(), *m_factory);
+        MultiFab::Copy(*mf, *cached, 0, 0, cached->nComp(), ngrow);
+        return mf;
+    }
+
+    return deriveNoCache(name, time, ngrow);
+}
+
+std::shared_ptr<MultiFab const>
+AmrLevel::deriveShared (const std::string& name, Real time, int ngrow)
+{
+    if (parent == nullptr || !parent->cacheDerived()) {
+        return derive(name, time, ngrow);
+    }
+
+    if (auto cached = findDerivedCache(name, time, ngrow)) {
+        return cached;
+    }
+
+    // Call the virtual derive so that overrides are honored.  AmrLevel::derive
+    // adds its result to the cache, an override may not.
+    std::shared_ptr<MultiFab const> mf = derive(name, time, ngrow);
+    if (auto cached = findDerivedCache(name, time, ngrow)) {
+        return cached;
+    }
+    m_derive_cache.push_back({name, time, ngrow, mf});
+    return mf;
+}
+
+std::shared_ptr<MultiFab const>
+AmrLevel::cachedDerive (const std::string& name, Real time, int ngrow)
+{
+    if (auto cached = findDerivedCache(name, time, ngrow)) {
+        return cached;
+    }
+    std::shared_ptr<MultiFab const> mf = deriveNoCache(name, time, ngrow);
+    m_derive_cache.push_back({name, time, ngrow, mf});
+    return mf;
+}
+
+std::unique_ptr<MultiFab>
+AmrLevel::deriveNoCache (const std::string& name, Real time, int ngrow)
+{
     std::unique_ptr<MultiFab> mf;
 
     int index, scomp, ncomp;
@@ -1740,6 +1788,21 @@ AmrLevel::derive (const std::string& name, Real time, MultiFab& mf, int dcomp)
 
     const int ngrow = mf.nGrow();
 
+    // The cached MultiFab is on this level's layout, so only derive into
+    // the cache if mf has that layout too.
+    if (parent != nullptr && parent->cacheDerived() &&
+        mf.DistributionMap() == dmap &&
+        amrex::convert(mf.boxArray(), IndexType::TheCellType()) == grids)
+    {
+        auto cached = cachedDerive(name, time, ngrow);
+        if (cached->boxArray() == mf.boxArray() &&
+            cached->DistributionMap() == mf.DistributionMap())
+        {
+            MultiFab::Copy(mf, *cached, 0, dcomp, cached->nComp(), ngrow);
+            return;
+        }
+    }
+
     int index, scomp, ncomp;
 
     if (isStateVariable(name,index,scomp))
@@ -1847,6 +1910,17 @@ AmrLevel::derive (const std::string& name, Real time, MultiFab& mf, int dcomp)
     }
 }
 
+std::shared_ptr<MultiFab const>
+AmrLevel::findDerivedCache (const std::string& name, Real time, int ngrow) const
+{
+    for (auto const& entry : m_derive_cache) {
+        if (entry.name == name && entry.time == time && entry.ngrow == ngrow) {
+            return entry.mf;
+        }
+    }
+    return nullptr;
+}
+
 //! Update the distribution maps in StateData based on the size of the map
 void
 AmrLevel::UpdateDistributionMaps ( DistributionMapping& update_dmap )
@@ -2199,6 +2273,7 @@ AmrLevel::FillPatch (AmrLevel& amrlevel,
     FillPatchIterator fpi(amrlevel, leveldata, boxGrow, time, index, scomp, ncomp);
     const MultiFab& mf_fillpatched = fpi.get_mf();
     MultiFab::Copy(leveldata, mf_fillpatched, 0, dcomp, ncomp, boxGrow);
+    leveldata.setNGrowFilled(IntVect(boxGrow));
 }
 
 void
@@ -528,11 +528,11 @@ FluxRegister::Reflux (MultiFab&       mf,
                       int             nc,
                       const Geometry& geom)
 {
-    for (OrientationIter fi; fi; ++fi)
-    {
-        const Orientation& face = fi();
-        Reflux(mf, volume, face, scale, scomp, dcomp, nc, geom);
+    Vector<Orientation> faces;
+    for (OrientationIter fi; fi; ++fi) {
+        faces.push_back(fi());
     }
+    Reflux(mf, &volume, Real(0.0), faces, scale, scomp, dcomp, nc, geom);
 }
 
 void
@@ -545,12 +545,9 @@ FluxRegister::Reflux (MultiFab&       mf,
                       int             nc,
                       const Geometry& geom)
 {
-    for (int s = 0; s < 2; ++s)
-    {
-        Orientation::Side side = (s==0) ? Orientation::low : Orientation::high;
-        Orientation face(dir, side);
-        Reflux(mf, volume, face, scale, scomp, dcomp, nc, geom);
-    }
+    Vector<Orientation> faces{Orientation(dir, Orientation::low),
+                              Orientation(dir, Orientation::high)};
+    Reflux(mf, &volume, Real(0.0), faces, scale, scomp, dcomp, nc, geom);
 }
 
 void
@@ -562,13 +559,11 @@ FluxRegister::Reflux (MultiFab&       mf,
                       const Geometry& geom)
 {
     const Real* dx = geom.CellSize();
-
-    MultiFab volume(mf.boxArray(), mf.DistributionMap(), 1, 0,
-                    MFInfo(), mf.Factory());
-
-    volume.setVal(AMREX_D_TERM(dx[0],*dx[1],*dx[2]), 0, 1, 0);
-
-    Reflux(mf,volume,scale,scomp,dcomp,nc,geom);
+    Vector<Orientation> faces;
+    for (OrientationIter fi; fi; ++fi) {
+        faces.push_back(fi());
+    }
+    Reflux(mf, nullptr, AMREX_D_TERM(dx[0],*dx[1],*dx[2]), faces, scale, scomp, dcomp, nc, geom);
 }
 
 void
@@ -581,63 +576,86 @@ FluxRegister::Reflux (MultiFab&       mf,
                       const Geometry& geom)
 {
     const Real* dx = geom.CellSize();
-
-    MultiFab volume(mf.boxArray(), mf.DistributionMap(), 1, 0,
-                    MFInfo(), mf.Factory());
-
-    volume.setVal(AMREX_D_TERM(dx[0],*dx[1],*dx[2]), 0, 1, 0);
-
-    Reflux(mf,volume,dir,scale,scomp,dcomp,nc,geom);
+    Vector<Orientation> faces{Orientation(dir, Orientation::low),
+                              Orientation(dir, Orientation::high)};
+    Reflux(mf, nullptr, AMREX_D_TERM(dx[0],*dx[1],*dx[2]), faces, scale, scomp, dcomp, nc, geom);
 }
 
 void
 FluxRegister::Reflux (MultiFab& mf, const MultiFab& volume, Orientation face,
                       Real scale, int scomp, int dcomp, int nc, const Geometry& geom)
+{
+    Reflux(mf, &volume, Real(0.0), Vector<Orientation>{face}, scale, scomp, dcomp, nc, geom);
+}
+
+void
+FluxRegister::Reflux (MultiFab& mf, const MultiFab* volume, Real const_volume,
+                      Vector<Orientation> const& faces, Real scale,
+                      int scomp, int dcomp, int nc, const Geometry& geom)
 {
     BL_PROFILE("FluxRegister::Reflux()");
 
-    int idir = face.coordDir();
+    //
+    // Only the coarse cells next to the fine grids need to be updated.  So
+    // we compute the corrections on a compact BoxArray made of those cells
+    // for all the faces, using the DistributionMapping of the registers so
+    // that no communication is needed for that.  Then the corrections are
+    // added to the coarse data with a single ParallelAdd.
+    //
+    const auto nfabs = static_cast<int>(grids.size());
+    const auto nfaces = static_cast<int>(faces.size());
+    if (nfabs == 0 || nfaces == 0) { return; }
+
+    const DistributionMapping& dm = bndry[faces[0]].DistributionMap();
+
+    BoxList bl;
+    bl.reserve(std::size_t(nfaces)*nfabs);
+    Vector<int> pmap;
+    pmap.reserve(std::size_t(nfaces)*nfabs);
+    for (auto const& face : faces) {
+        const int idir = face.coordDir();
+        for (int i = 0; i < nfabs; ++i) {
+            bl.push_back(face.isLow() ? amrex::adjCellLo(grids[i], idir)
+                                      : amrex::adjCellHi(grids[i], idir));
+            pmap.push_back(dm[i]);
+        }
+    }
+
+    BoxArray cf_ba(std::move(bl));
+    DistributionMapping cf_dm(std::move(pmap));
 
-    MultiFab flux(amrex::convert(mf.boxArray(), IntVect::TheDimensionVector(idir)),
-                  mf.DistributionMap(), nc, 0, MFInfo(), mf.Factory());
-    flux.setVal(0.0);
+    MultiFab cf_vol(cf_ba, cf_dm, 1, 0);
+    if (volume) {
+        // Cells outside the domain that are not periodic images of valid
+        // cells are not used, but we still need something sane there.
+        cf_vol.setVal(1.0);
+        cf_vol.ParallelCopy(*volume, 0, 0, 1, IntVect(0), IntVect(0), geom.periodicity());
+    } else {
+        cf_vol.setVal(const_volume);
+    }
 
-    bndry[face].copyTo(flux, 0, scomp, 0, nc, geom.periodicity());
+    MultiFab cf_corr(cf_ba, cf_dm, nc, 0);
+    cf_corr.setVal(0.0);
 
-#ifdef AMREX_USE_GPU
-    if (Gpu::inLaunchRegion() && mf.isFusingCandidate()) {
-        auto const& sma = mf.arrays();
-        auto const& fma = flux.const_arrays();
-        auto const& vma = volume.const_arrays();
-        ParallelFor(mf, [=] AMREX_GPU_DEVICE (int box_no, int i, int j, int k) noexcept
-        {
-#if (AMREX_SPACEDIM == 1)
-            amrex::ignore_unused(j,k);
-#elif (AMREX_SPACEDIM == 2)
-            amrex::ignore_unused(k);
-#endif
-            fluxreg_reflux(Box(IntVect(AMREX_D_DECL(i,j,k)),IntVect(AMREX_D_DECL(i,j,k))),
-                           sma[box_no], dcomp, fma[box_no], vma[box_no], nc, scale, face);
-        });
-        Gpu::streamSynchronize();
-    } else
-#endif
-    {
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (Gpu::notInLaunchRegion())
 #endif
-        for (MFIter mfi(mf,TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    for (MFIter mfi(cf_corr); mfi.isValid(); ++mfi)
+    {
+        const int iface = mfi.index() / nfabs;
+        const int ifab  = mfi.index() - iface*nfabs;
+        const Orientation face = faces[iface];
+        const Box& bx = mfi.validbox();
+        Array4<Real> const& sfab = cf_corr.array(mfi);
+        Array4<Real const> const& ffab = bndry[face][ifab].const_array(scomp);
+        Array4<Real const> const& vfab = cf_vol.const_array(mfi);
+        AMREX_LAUNCH_HOST_DEVICE_LAMBDA (bx, tbx,
         {
-            const Box& bx = mfi.tilebox();
-            Array4<Real> const& sfab = mf.array(mfi);
-            Array4<Real const> const& ffab = flux.const_array(mfi);
-            Array4<Real const> const& vfab = volume.const_array(mfi);
-            AMREX_LAUNCH_HOST_DEVICE_LAMBDA (bx, tbx,
-            {
-                fluxreg_reflux(tbx, sfab, dcomp, ffab, vfab, nc, scale, face);
-            });
-        }
+            fluxreg_reflux(tbx, sfab, 0, ffab, vfab, nc, scale, face);
+        });
     }
+
+    mf.ParallelAdd(cf_corr, 0, dcomp, nc, geom.periodicity());
 }
 
 void
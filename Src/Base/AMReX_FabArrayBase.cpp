@@ -2609,6 +2609,15 @@ FabArrayBase::is_cell_centered () const noexcept
     return boxArray().ixType().cellCentered();
 }
 
+void
+FabArrayBase::setNGrowFilled (FabArrayBase const& src, IntVect const& ng_stencil) noexcept
+{
+    IntVect ng = src.nGrowFilled() - ng_stencil;
+    ng.max(IntVect(0));
+    ng.min(n_grow);
+    n_filled = ng;
+}
+
 bool
 FabArrayBase::isFusingCandidate () const noexcept // NOLINT(readability-convert-member-functions-to-static)
 {
@@ -502,6 +502,15 @@ MFIter::growntilebox (const IntVect& ng) const noexcept
     return bx;
 }
 
+Box
+MFIter::growntilebox (const FabArrayBase& src, const IntVect& ng_stencil) const noexcept
+{
+    IntVect ng = src.nGrowFilled() - ng_stencil;
+    ng.max(IntVect(0));
+    ng.min(fabArray->nGrowVect());
+    return growntilebox(ng);
+}
+
 Box
 MFIter::grownnodaltilebox (int dir, int a_ng) const noexcept
 {
@@ -1023,8 +1023,8 @@ MLEBABecLap::applyBC (int amrlev, int mglev, MultiFab& in, BCMode bc_mode, State
 
     const int ncomp = getNComp();
     if (!skip_fillboundary) {
-        const int cross = false;
-        in.FillBoundary(0, ncomp, m_geom[amrlev][mglev].periodicity(),cross);
+        const bool cross = false;
+        stencilFillBoundary(amrlev, mglev, in, ncomp, cross);
     }
 
     int m_is_inhomog = bc_mode == BCMode::Inhomogeneous;
@@ -1,4 +1,5 @@
 #include <AMReX_ParticleBufferMap.H>
+#include <AMReX_ParticleUtil.H>
 
 using namespace amrex;
 
@@ -12,6 +13,7 @@ void ParticleBufferMap::define (const ParGDBBase* a_gdb)
     BL_PROFILE("ParticleBufferMap::define");
 
     m_defined = true;
+    m_neighbor_procs.clear();
 
     int num_levels = a_gdb->finestLevel()+1;
     m_ba.resize(0);
@@ -130,3 +132,14 @@ bool ParticleBufferMap::isValid (const ParGDBBase* a_gdb) const
 
     return valid;
 }
+
+Vector<int> const& ParticleBufferMap::neighborProcs (const ParGDBBase* a_gdb, int ngrow) const
+{
+    AMREX_ASSERT(isValid(a_gdb));
+
+    auto it = m_neighbor_procs.find(ngrow);
+    if (it == m_neighbor_procs.end()) {
+        it = m_neighbor_procs.emplace(ngrow, computeNeighborProcs(a_gdb, ngrow)).first;
+    }
+    return it->second;
+}
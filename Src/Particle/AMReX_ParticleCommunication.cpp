@@ -1,4 +1,5 @@
 #include <AMReX_ParticleCommunication.H>
+#include <AMReX_ParticleMPIUtil.H>
 #include <AMReX_ParallelDescriptor.H>
 
 using namespace amrex;
@@ -262,8 +263,12 @@ void ParticleCopyPlan::buildMPIFinish (const ParticleBufferMap& map) // NOLINT(r
 void ParticleCopyPlan::doHandShake (const Vector<Long>& Snds, Vector<Long>& Rcvs) const // NOLINT(readability-convert-member-functions-to-static)
 {
     BL_PROFILE("ParticleCopyPlan::doHandShake");
+#ifdef AMREX_USE_MPI
     if (m_local) { doHandShakeLocal(Snds, Rcvs); }
-    else         { doHandShakeGlobal(Snds, Rcvs); }
+    else         { amrex::doHandShakeGlobal(Snds, Rcvs); }
+#else
+    amrex::ignore_unused(Snds,Rcvs);
+#endif
 }
 
 void ParticleCopyPlan::doHandShakeLocal (const Vector<Long>& Snds, Vector<Long>& Rcvs) const // NOLINT(readability-convert-member-functions-to-static)
@@ -310,77 +315,6 @@ void ParticleCopyPlan::doHandShakeLocal (const Vector<Long>& Snds, Vector<Long>&
 #endif
 }
 
-void ParticleCopyPlan::doHandShakeAllToAll (const Vector<Long>& Snds, Vector<Long>& Rcvs)
-{
-#ifdef AMREX_USE_MPI
-    BL_COMM_PROFILE(BLProfiler::Alltoall, sizeof(Long),
-                    ParallelContext::MyProcSub(), BLProfiler::BeforeCall());
-
-    BL_MPI_REQUIRE( MPI_Alltoall(Snds.dataPtr(),
-                                 1,
-                                 ParallelDescriptor::Mpi_typemap<Long>::type(),
-                                 Rcvs.dataPtr(),
-                                 1,
-                                 ParallelDescriptor::Mpi_typemap<Long>::type(),
-                                 ParallelContext::CommunicatorSub()) );
-
-    AMREX_ASSERT(Rcvs[ParallelContext::MyProcSub()] == 0);
-
-    BL_COMM_PROFILE(BLProfiler::Alltoall, sizeof(Long),
-                    ParallelContext::MyProcSub(), BLProfiler::AfterCall());
-#else
-    amrex::ignore_unused(Snds,Rcvs);
-#endif
-}
-
-void ParticleCopyPlan::doHandShakeGlobal (const Vector<Long>& Snds, Vector<Long>& Rcvs)
-{
-#ifdef AMREX_USE_MPI
-    const int SeqNum = ParallelDescriptor::SeqNum();
-    const int NProcs = ParallelContext::NProcsSub();
-
-    Vector<Long> snd_connectivity(NProcs, 0);
-    Vector<int > rcv_connectivity(NProcs, 1);
-    for (int i = 0; i < NProcs; ++i) { if (Snds[i] > 0) { snd_connectivity[i] = 1; } }
-
-    Long num_rcvs = 0;
-    MPI_Reduce_scatter(snd_connectivity.data(), &num_rcvs, rcv_connectivity.data(),
-                       ParallelDescriptor::Mpi_typemap<Long>::type(), MPI_SUM,
-                       ParallelContext::CommunicatorSub());
-
-    Vector<MPI_Status>  rstats(num_rcvs);
-    Vector<MPI_Request> rreqs(num_rcvs);
-    Vector<MPI_Status>  sstats;
-    Vector<MPI_Request> sreqs;
-
-    Vector<Long> num_bytes_rcv(num_rcvs);
-    for (int i = 0; i < static_cast<int>(num_rcvs); ++i)
-    {
-        BL_MPI_REQUIRE(MPI_Irecv( &num_bytes_rcv[i], 1, ParallelDescriptor::Mpi_typemap<Long>::type(),
-                                  MPI_ANY_SOURCE, SeqNum, ParallelContext::CommunicatorSub(), &rreqs[i] ));
-    }
-    for (int i = 0; i < NProcs; ++i)
-    {
-        if (Snds[i] == 0) { continue; }
-        const Long Cnt = 1;
-        sreqs.push_back(ParallelDescriptor::Asend( &Snds[i], Cnt, i, SeqNum, ParallelContext::CommunicatorSub()).req());
-    }
-
-    sstats.resize(0);
-    sstats.resize(sreqs.size());
-    ParallelDescriptor::Waitall(sreqs, sstats);
-    ParallelDescriptor::Waitall(rreqs, rstats);
-
-    for (int i = 0; i < num_rcvs; ++i)
-    {
-        const auto Who = rstats[i].MPI_SOURCE;
-        Rcvs[Who] = num_bytes_rcv[i];
-    }
-#else
-    amrex::ignore_unused(Snds,Rcvs);
-#endif
-}
-
 void amrex::communicateParticlesFinish (const ParticleCopyPlan& plan)
 {
     BL_PROFILE("amrex::communicateParticlesFinish");
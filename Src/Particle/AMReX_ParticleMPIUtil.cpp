@@ -1,11 +1,46 @@
 #include <AMReX_ParticleMPIUtil.H>
 
+#include <AMReX.H>
 #include <AMReX_ParallelDescriptor.H>
 #include <AMReX_ParallelReduce.H>
+#include <AMReX_ParmParse.H>
 #include <AMReX_BLProfiler.H>
 
 namespace amrex {
 
+    namespace {
+        enum struct HandShakeType { NBX, AllToAll, ReduceScatter };
+        HandShakeType handshake_type = HandShakeType::NBX;
+        bool handshake_initialized = false;
+    }
+
+    void ParticleHandShake_Initialize ()
+    {
+        if (handshake_initialized) { return; }
+        handshake_initialized = true;
+
+        std::string handshake = "nbx";
+        ParmParse pp("particles");
+        pp.queryAdd("handshake", handshake);
+        if (handshake == "nbx") {
+            handshake_type = HandShakeType::NBX;
+        } else if (handshake == "alltoall") {
+            handshake_type = HandShakeType::AllToAll;
+        } else if (handshake == "reduce_scatter") {
+            handshake_type = HandShakeType::ReduceScatter;
+        } else {
+            amrex::Abort("particles.handshake must be nbx, alltoall or reduce_scatter");
+        }
+
+        amrex::ExecOnFinalize(ParticleHandShake_Finalize);
+    }
+
+    void ParticleHandShake_Finalize ()
+    {
+        handshake_type = HandShakeType::NBX;
+        handshake_initialized = false;
+    }
+
 #ifdef AMREX_USE_MPI
 
     Long CountSnds(const std::map<int, Vector<char> >& not_ours, Vector<Long>& Snds)
@@ -22,31 +57,6 @@ namespace amrex {
         return NumSnds;
     }
 
-    Long doHandShake(const std::map<int, Vector<char> >& not_ours,
-                     Vector<Long>& Snds, Vector<Long>& Rcvs)
-    {
-        Long NumSnds = CountSnds(not_ours, Snds);
-        if (NumSnds == 0) { return NumSnds; }
-
-        BL_COMM_PROFILE(BLProfiler::Alltoall, sizeof(Long),
-                        ParallelContext::MyProcSub(), BLProfiler::BeforeCall());
-
-        BL_MPI_REQUIRE( MPI_Alltoall(Snds.dataPtr(),
-                                     1,
-                                     ParallelDescriptor::Mpi_typemap<Long>::type(),
-                                     Rcvs.dataPtr(),
-                                     1,
-                                     ParallelDescriptor::Mpi_typemap<Long>::type(),
-                                     ParallelContext::CommunicatorSub()) );
-
-        AMREX_ASSERT(Rcvs[ParallelContext::MyProcSub()] == 0);
-
-        BL_COMM_PROFILE(BLProfiler::Alltoall, sizeof(Long),
-                        ParallelContext::MyProcSub(), BLProfiler::AfterCall());
-
-        return NumSnds;
-    }
-
     Long doHandShakeLocal(const std::map<int, Vector<char> >& not_ours,
                           const Vector<int>& neighbor_procs, Vector<Long>& Snds, Vector<Long>& Rcvs)
     {
@@ -92,6 +102,151 @@ namespace amrex {
 
         return NumSnds;
     }
+
+    void doHandShakeNBX (const Vector<Long>& Snds, Vector<Long>& Rcvs)
+    {
+        const int SeqNum = ParallelDescriptor::SeqNum();
+        const int NProcs = ParallelContext::NProcsSub();
+        MPI_Comm comm = ParallelContext::CommunicatorSub();
+        const auto long_type = ParallelDescriptor::Mpi_typemap<Long>::type();
+
+        // Synchronous sends complete only after they have been matched, so once
+        // all our sends are done, every message for us has been posted.
+        Vector<MPI_Request> sreqs;
+        for (int i = 0; i < NProcs; ++i)
+        {
+            if (Snds[i] == 0) { continue; }
+            sreqs.emplace_back();
+            BL_MPI_REQUIRE( MPI_Issend(&Snds[i], 1, long_type, i, SeqNum, comm, &sreqs.back()) );
+        }
+
+        MPI_Request barrier_req = MPI_REQUEST_NULL;
+        bool barrier_posted = false;
+        while (true)
+        {
+            int flag = 0;
+            MPI_Status status;
+            BL_MPI_REQUIRE( MPI_Iprobe(MPI_ANY_SOURCE, SeqNum, comm, &flag, &status) );
+            if (flag)
+            {
+                const auto Who = status.MPI_SOURCE;
+                BL_MPI_REQUIRE( MPI_Recv(&Rcvs[Who], 1, long_type, Who, SeqNum, comm,
+                                         MPI_STATUS_IGNORE) );
+            }
+
+            if (barrier_posted)
+            {
+                int done = 0;
+                BL_MPI_REQUIRE( MPI_Test(&barrier_req, &done, MPI_STATUS_IGNORE) );
+                if (done) { break; }
+            }
+            else
+            {
+                int sent = 0;
+                BL_MPI_REQUIRE( MPI_Testall(static_cast<int>(sreqs.size()), sreqs.data(), &sent,
+                                            MPI_STATUSES_IGNORE) );
+                if (sent)
+                {
+                    BL_MPI_REQUIRE( MPI_Ibarrier(comm, &barrier_req) );
+                    barrier_posted = true;
+                }
+            }
+        }
+    }
+
+    void doHandShakeAllToAll (const Vector<Long>& Snds, Vector<Long>& Rcvs)
+    {
+        BL_COMM_PROFILE(BLProfiler::Alltoall, sizeof(Long),
+                        ParallelContext::MyProcSub(), BLProfiler::BeforeCall());
+
+        BL_MPI_REQUIRE( MPI_Alltoall(Snds.dataPtr(),
+                                     1,
+                                     ParallelDescriptor::Mpi_typemap<Long>::type(),
+                                     Rcvs.dataPtr(),
+                                     1,
+                                     ParallelDescriptor::Mpi_typemap<Long>::type(),
+                                     ParallelContext::CommunicatorSub()) );
+
+        AMREX_ASSERT(Rcvs[ParallelContext::MyProcSub()] == 0);
+
+        BL_COMM_PROFILE(BLProfiler::Alltoall, sizeof(Long),
+                        ParallelContext::MyProcSub(), BLProfiler::AfterCall());
+    }
+
+    void doHandShakeReduceScatter (const Vector<Long>& Snds, Vector<Long>& Rcvs)
+    {
+        const int SeqNum = ParallelDescriptor::SeqNum();
+        const int NProcs = ParallelContext::NProcsSub();
+
+        Vector<Long> snd_connectivity(NProcs, 0);
+        Vector<int > rcv_connectivity(NProcs, 1);
+        for (int i = 0; i < NProcs; ++i) { if (Snds[i] > 0) { snd_connectivity[i] = 1; } }
+
+        Long num_rcvs = 0;
+        MPI_Reduce_scatter(snd_connectivity.data(), &num_rcvs, rcv_connectivity.data(),
+                           ParallelDescriptor::Mpi_typemap<Long>::type(), MPI_SUM,
+                           ParallelContext::CommunicatorSub());
+
+        Vector<MPI_Status>  rstats(num_rcvs);
+        Vector<MPI_Request> rreqs(num_rcvs);
+        Vector<MPI_Status>  sstats;
+        Vector<MPI_Request> sreqs;
+
+        Vector<Long> num_bytes_rcv(num_rcvs);
+        for (int i = 0; i < static_cast<int>(num_rcvs); ++i)
+        {
+            BL_MPI_REQUIRE(MPI_Irecv( &num_bytes_rcv[i], 1, ParallelDescriptor::Mpi_typemap<Long>::type(),
+                                      MPI_ANY_SOURCE, SeqNum, ParallelContext::CommunicatorSub(), &rreqs[i] ));
+        }
+        for (int i = 0; i < NProcs; ++i)
+        {
+            if (Snds[i] == 0) { continue; }
+            const Long Cnt = 1;
+            sreqs.push_back(ParallelDescriptor::Asend( &Snds[i], Cnt, i, SeqNum, ParallelContext::CommunicatorSub()).req());
+        }
+
+        sstats.resize(0);
+        sstats.resize(sreqs.size());
+        ParallelDescriptor::Waitall(sreqs, sstats);
+        ParallelDescriptor::Waitall(rreqs, rstats);
+
+        for (int i = 0; i < num_rcvs; ++i)
+        {
+            const auto Who = rstats[i].MPI_SOURCE;
+            Rcvs[Who] = num_bytes_rcv[i];
+        }
+    }
+
+    void doHandShakeGlobal (const Vector<Long>& Snds, Vector<Long>& Rcvs)
+    {
+        switch (handshake_type)
+        {
+        case HandShakeType::AllToAll:
+            doHandShakeAllToAll(Snds, Rcvs);
+            break;
+        case HandShakeType::ReduceScatter:
+            doHandShakeReduceScatter(Snds, Rcvs);
+            break;
+        default:
+            doHandShakeNBX(Snds, Rcvs);
+        }
+    }
+
+    Long doHandShakeGlobal (const std::map<int, Vector<char> >& not_ours,
+                            Vector<Long>& Snds, Vector<Long>& Rcvs)
+    {
+        Long NumSnds = 0;
+        for (const auto& kv : not_ours)
+        {
+            NumSnds       += kv.second.size();
+            Snds[kv.first] = kv.second.size();
+        }
+
+        doHandShakeGlobal(Snds, Rcvs);
+
+        return NumSnds;
+    }
+
 #endif  // AMREX_USE_MPI
 
 }
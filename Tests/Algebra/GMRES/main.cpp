@@ -114,6 +114,44 @@ int main (int argc, char* argv[])
         auto error = xvec.norminf();
         amrex::Print() << " Max norm error: " << error << "\n";
         AMREX_ALWAYS_ASSERT(error*10 < eps);
+
+        // A sequence of solves with and without Krylov subspace recycling
+        int niters[2] = {0, 0};
+        for (int irecycle = 0; irecycle < 2; ++irecycle) {
+            GMRES_MV<Real> gmres2(&mat);
+            gmres2.setPrecond(JacobiSmoother<Real>(&mat));
+            gmres2.getGMRES().setRecycleLength(irecycle*10);
+            for (int isolve = 0; isolve < 4; ++isolve) {
+                // The exact solution is phi + isolve * cos(x).
+                {
+                    auto* psol = xvec.data();
+                    auto const* phi = exact.data();
+                    auto nrows = xvec.numLocalRows();
+                    auto ib = xvec.globalBegin();
+                    ParallelFor(nrows, [=] AMREX_GPU_DEVICE (Long lrow)
+                    {
+                        IntVect cell = box_indexer.intVect(lrow + ib);
+                        psol[lrow] = phi[lrow] + Real(isolve)*std::cos((cell[0]+Real(0.5))*dx);
+                    });
+                }
+                SpMV(bvec, mat, xvec);
+                AlgVector<Real> sol(xvec.partition());
+                sol.setVal(0);
+                gmres2.solve(sol, bvec, eps, Real(0.0));
+                if (isolve > 0) {
+                    niters[irecycle] += gmres2.getGMRES().getNumIters();
+                }
+                // The residual is checked, because the error of the nearly
+                // singular constant mode can be much larger.
+                AlgVector<Real> res(xvec.partition());
+                SpMV(res, mat, sol);
+                amrex::Axpy(res, Real(-1.0), bvec);
+                AMREX_ALWAYS_ASSERT(res.norm2() < Real(10.)*eps*bvec.norm2());
+            }
+        }
+        amrex::Print() << " Iterations of solves 2-4 without and with recycling: "
+                       << niters[0] << " " << niters[1] << "\n";
+        AMREX_ALWAYS_ASSERT(niters[1] < niters[0]);
     }
     amrex::Finalize();
 }
@@ -7,12 +7,17 @@
 #include "Prob.H"
 #include "Kernels.H"
 
+#include <chrono>
+#include <cmath>
+#include <thread>
 
 using namespace amrex;
 
 int      AmrLevelAdv::verbose         = 0;
 Real     AmrLevelAdv::cfl             = 0.9;
 int      AmrLevelAdv::do_reflux       = 1;
+int      AmrLevelAdv::check_level_tasks = 0;
+int      AmrLevelAdv::check_derive_cache = 0;
 
 int      AmrLevelAdv::NUM_STATE       = 1;  // One variable in the state
 int      AmrLevelAdv::NUM_GROW        = 3;  // number of ghost cells
@@ -234,6 +239,23 @@ AmrLevelAdv::advance (Real time,
     Real minval = S_mm.min(0);
 
     amrex::Print() << "phi max = " << maxval << ", min = " << minval  << '\n';
+
+    if (check_derive_cache) {
+        // Derived data cached during the previous post_timestep of this
+        // level were computed before reflux and average down modified the
+        // state.  Amr must have discarded them.
+        const Real t = state[Phi_Type].curTime();
+        auto phi = deriveShared("phi", t, 0);
+        if (parent->cacheDerived() && deriveShared("phi", t, 0) != phi) {
+            amrex::Abort("AmrLevelAdv: derive cache missed");
+        }
+        MultiFab diff(grids, dmap, 1, 0);
+        MultiFab::Copy(diff, *phi, 0, 0, 1, 0);
+        MultiFab::Subtract(diff, S_mm, 0, 0, 1, 0);
+        if (diff.norminf(0, 0) != 0.0) {
+            amrex::Abort("AmrLevelAdv: derive cache is stale");
+        }
+    }
     for (int k = 0; k < NUM_STATE_TYPE; k++) {
         state[k].allocOldData();
         state[k].swapTimeLevels(dt);
@@ -396,6 +418,21 @@ AmrLevelAdv::advance (Real time,
     }
 #endif
 
+    if (check_level_tasks) {
+        // Sum the new state on a background thread, while the finer levels
+        // are advanced.  The task is slow on purpose, so that post_timestep
+        // would see an unfinished task if Amr did not wait for it.
+        task_done = false;
+        // MFIter cannot be used off the main thread, so the task loops over
+        // the local boxes with IndexArray.
+        parent->submitLevelTask(level, [this] ()
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            task_sum = localSum(get_new_data(Phi_Type));
+            task_done = true;
+        });
+    }
+
     return dt;
 }
 
@@ -603,6 +640,24 @@ AmrLevelAdv::post_timestep (int iteration)
     //
     int finest_level = parent->finestLevel();
 
+    if (check_level_tasks) {
+        // The task submitted in advance must have finished, and the state
+        // must not have changed since.
+        if (!task_done) {
+            amrex::Abort("AmrLevelAdv: level task not finished before post_timestep");
+        }
+        const Real sum = localSum(get_new_data(Phi_Type));
+        if (std::abs(task_sum - sum) > 1.e-12*std::abs(sum)) {
+            amrex::Abort("AmrLevelAdv: level task saw a different state");
+        }
+        task_done = false;
+    }
+
+    if (check_derive_cache) {
+        // Fill the cache with the state before reflux and average down.
+        amrex::ignore_unused(deriveShared("phi", state[Phi_Type].curTime(), 0));
+    }
+
     if (do_reflux && level < finest_level) {
         reflux();
     }
@@ -738,6 +793,19 @@ AmrLevelAdv::errorEst (TagBoxArray& tags,
     }
 }
 
+/**
+ * Sum of component 0 over the boxes owned by this process, without MFIter.
+ */
+Real
+AmrLevelAdv::localSum (MultiFab const& mf)
+{
+    Real r = 0.0;
+    for (int i : mf.IndexArray()) {
+        r += mf[i].sum<RunOn::Host>(mf.box(i), 0);
+    }
+    return r;
+}
+
 /**
  * Read parameters from input file.
  */
@@ -755,6 +823,13 @@ AmrLevelAdv::read_params ()
     pp.query("v",verbose);
     pp.query("cfl",cfl);
     pp.query("do_reflux",do_reflux);
+    pp.query("check_level_tasks",check_level_tasks);
+    pp.query("check_derive_cache",check_derive_cache);
+#ifdef AMREX_USE_GPU
+    if (check_level_tasks) {
+        amrex::Abort("adv.check_level_tasks is not supported in GPU builds");
+    }
+#endif
 
     Geometry const* gg = AMReX::top()->getDefaultGeometry();
 
@@ -0,0 +1,148 @@
+#include <AMReX.H>
+#include <AMReX_Geometry.H>
+#include <AMReX_MultiFab.H>
+#include <AMReX_MFParallelFor.H>
+#include <AMReX_ParReduce.H>
+
+using namespace amrex;
+
+namespace {
+    int nerrors = 0;
+
+    void check (IntVect const& ng_filled, IntVect const& ng_expected, char const* what)
+    {
+        if (ng_filled != ng_expected) {
+            ++nerrors;
+            amrex::Print() << "FAIL: " << what << ": nGrowFilled = " << ng_filled
+                           << ", expected " << ng_expected << "\n";
+        }
+    }
+
+    // Number of cells in mf, including ng ghost cells, that differ from the
+    // periodic function expected.
+    template <typename F>
+    Long countWrong (MultiFab const& mf, IntVect const& ng, F const& expected)
+    {
+        auto const& ma = mf.const_arrays();
+        return ParReduce(TypeList<ReduceOpSum>{}, TypeList<Long>{}, mf, ng,
+                         [=] AMREX_GPU_DEVICE (int b, int i, int j, int k) -> GpuTuple<Long>
+                         {
+                             return { Long(expected(i,j,k) != ma[b](i,j,k)) };
+                         });
+    }
+
+    // One stage of a stencil of half-width 1, computed on the region allowed
+    // by the ghost cells of src that have been filled.
+    void stage (MultiFab& dst, MultiFab const& src)
+    {
+        for (MFIter mfi(dst); mfi.isValid(); ++mfi) {
+            Box const& bx = mfi.growntilebox(src, IntVect(1));
+            auto const& d = dst.array(mfi);
+            auto const& s = src.const_array(mfi);
+            ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k)
+            {
+                d(i,j,k) = Real(2.)*s(i,j,k) + AMREX_D_TERM(s(i-1,j,k) - s(i+1,j,k),
+                                                            + s(i,j-1,k) - s(i,j+1,k),
+                                                            + s(i,j,k-1) - s(i,j,k+1));
+            });
+        }
+        dst.setNGrowFilled(src, IntVect(1));
+    }
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc, argv);
+    {
+        constexpr int ncell = 32;
+        Box domain(IntVect(0), IntVect(ncell-1));
+        Array<int,AMREX_SPACEDIM> is_periodic{AMREX_D_DECL(1,1,1)};
+        Geometry geom(domain, RealBox(AMREX_D_DECL(Real(0),Real(0),Real(0)),
+                                      AMREX_D_DECL(Real(1),Real(1),Real(1))),
+                      CoordSys::cartesian, is_periodic);
+        BoxArray ba(domain);
+        ba.maxSize(8);
+        DistributionMapping dm(ba);
+
+        // Small integers, so that they are exact in a float buffer.
+        auto expected = [=] AMREX_GPU_DEVICE (int i, int j, int k) -> Real
+            {
+                i = (i+ncell) % ncell;
+                j = (j+ncell) % ncell;
+                k = (k+ncell) % ncell;
+                return Real(i + j*ncell + k*ncell*ncell);
+            };
+
+        const IntVect ng_deep(4);
+        MultiFab mf(ba, dm, 1, ng_deep);
+        mf.setVal(Real(-1.));
+        check(mf.nGrowFilled(), IntVect(0), "define");
+
+        auto const& ma = mf.arrays();
+        ParallelFor(mf, IntVect(0), [=] AMREX_GPU_DEVICE (int b, int i, int j, int k)
+        {
+            ma[b](i,j,k) = expected(i,j,k);
+        });
+
+        mf.FillBoundary(geom.periodicity());
+        check(mf.nGrowFilled(), ng_deep, "FillBoundary");
+        if (countWrong(mf, ng_deep, expected) != 0) {
+            ++nerrors;
+            amrex::Print() << "FAIL: FillBoundary values\n";
+        }
+
+        // A second fill of fewer ghost cells must not leave the count of the
+        // first one behind, on either the default or the reduced-precision
+        // buffer path.
+        mf.FillBoundary(IntVect(1), geom.periodicity());
+        check(mf.nGrowFilled(), IntVect(1), "FillBoundary(1)");
+
+        mf.FillBoundary(ng_deep, geom.periodicity());
+        mf.FillBoundary<float>(IntVect(2), geom.periodicity());
+        check(mf.nGrowFilled(), IntVect(2), "FillBoundary<float>(2)");
+        if (countWrong(mf, IntVect(2), expected) != 0) {
+            ++nerrors;
+            amrex::Print() << "FAIL: FillBoundary<float> values\n";
+        }
+
+        mf.FillBoundary(IntVect(0), geom.periodicity());
+        check(mf.nGrowFilled(), IntVect(0), "FillBoundary(0)");
+
+        mf.FillBoundary(ng_deep, geom.periodicity());
+        mf.FillBoundary(geom.periodicity(), true);
+        check(mf.nGrowFilled(), IntVect(0), "FillBoundary(cross)");
+
+        MultiFab mf2(ba, dm, 1, ng_deep);
+        mf2.ParallelCopy<float>(mf, 0, 0, 1, IntVect(0), IntVect(3), geom.periodicity());
+        check(mf2.nGrowFilled(), IntVect(3), "ParallelCopy<float>(3)");
+        mf2.ParallelCopy<float>(mf, 0, 0, 1, IntVect(0), IntVect(1), geom.periodicity());
+        check(mf2.nGrowFilled(), IntVect(1), "ParallelCopy<float>(1)");
+
+        // Two stages after a single exchange of the deep halo must agree with
+        // two stages with an exchange before each.
+        MultiFab s1(ba, dm, 1, ng_deep);
+        MultiFab s2(ba, dm, 1, ng_deep);
+        mf.FillBoundary(geom.periodicity());
+        stage(s1, mf);
+        check(s1.nGrowFilled(), IntVect(3), "stage 1");
+        stage(s2, s1);
+        check(s2.nGrowFilled(), IntVect(2), "stage 2");
+
+        MultiFab r1(ba, dm, 1, 1);
+        MultiFab r2(ba, dm, 1, 1);
+        mf.FillBoundary(IntVect(1), geom.periodicity());
+        stage(r1, mf);
+        r1.FillBoundary(geom.periodicity());
+        stage(r2, r1);
+
+        MultiFab::Subtract(r2, s2, 0, 0, 1, 0);
+        if (r2.norminf(0, 0) != Real(0.)) {
+            ++nerrors;
+            amrex::Print() << "FAIL: deep halo stages differ from exchange per stage\n";
+        }
+
+        AMREX_ALWAYS_ASSERT(nerrors == 0);
+        amrex::Print() << "SUCCESS\n";
+    }
+    amrex::Finalize();
+}
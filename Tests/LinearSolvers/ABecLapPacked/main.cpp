@@ -0,0 +1,186 @@
+//
+// Benchmark of the packed stencil option of MLABecLaplacian.  The same
+// variable coefficient problem is solved with and without the packed
+// stencil, and the operator is applied and smoothed on every multigrid
+// level.  The timings are the minimum over several trials.  The solutions
+// must agree to round-off.
+//
+
+#include <AMReX.H>
+#include <AMReX_MLABecLaplacian.H>
+#include <AMReX_MLMG.H>
+#include <AMReX_ParmParse.H>
+
+#include <limits>
+
+using namespace amrex;
+
+namespace {
+
+struct Result
+{
+    Real solve_time = 0.0;
+    Vector<Real> apply_time;
+    Vector<Real> smooth_time;
+};
+
+template <typename F>
+Real minTime (int ntrials, F&& f)
+{
+    Real tmin = std::numeric_limits<Real>::max();
+    for (int itrial = 0; itrial < ntrials; ++itrial) {
+        ParallelDescriptor::Barrier();
+        Real t0 = amrex::second();
+        f();
+        ParallelDescriptor::Barrier();
+        tmin = std::min(tmin, amrex::second() - t0);
+    }
+    return tmin;
+}
+
+Result run (Geometry const& geom, BoxArray const& ba, DistributionMapping const& dm,
+            MultiFab const& acoef, Array<MultiFab,AMREX_SPACEDIM> const& bcoef,
+            MultiFab const& rhs, MultiFab& sol, int packed_level, int nsolves,
+            int napply, int ntrials, int verbose)
+{
+    MLABecLaplacian mlabec({geom}, {ba}, {dm});
+    mlabec.setDomainBC({AMREX_D_DECL(LinOpBCType::Dirichlet,
+                                     LinOpBCType::Dirichlet,
+                                     LinOpBCType::Dirichlet)},
+                       {AMREX_D_DECL(LinOpBCType::Dirichlet,
+                                     LinOpBCType::Dirichlet,
+                                     LinOpBCType::Dirichlet)});
+    mlabec.setLevelBC(0, nullptr);
+    mlabec.setScalars(1.0, 1.0);
+    mlabec.setACoeffs(0, acoef);
+    mlabec.setBCoeffs(0, amrex::GetArrOfConstPtrs(bcoef));
+    mlabec.setPackedStencilLevel(packed_level);
+
+    MLMG mlmg(mlabec);
+    mlmg.setVerbose(verbose);
+
+    Result r;
+    for (int isolve = 0; isolve < nsolves; ++isolve) {
+        sol.setVal(0.0);
+        ParallelDescriptor::Barrier();
+        Real t0 = amrex::second();
+        mlmg.solve({&sol}, {&rhs}, 1.e-10, 0.0);
+        ParallelDescriptor::Barrier();
+        r.solve_time += amrex::second() - t0;
+    }
+
+    const int nlevs = mlabec.NMGLevels(0);
+    r.apply_time.resize(nlevs, 0.0);
+    r.smooth_time.resize(nlevs, 0.0);
+    for (int mglev = 0; mglev < nlevs; ++mglev) {
+        MultiFab const& a = *mlabec.getACoeffs(0, mglev);
+        MultiFab in (a.boxArray(), a.DistributionMap(), 1, 1);
+        MultiFab out(a.boxArray(), a.DistributionMap(), 1, 0);
+        in.setVal(1.0);
+        out.setVal(1.0);
+        r.apply_time[mglev] = minTime(ntrials, [&] () {
+            for (int iapply = 0; iapply < napply; ++iapply) {
+                mlabec.Fapply(0, mglev, out, in);
+            }
+        });
+        r.smooth_time[mglev] = minTime(ntrials, [&] () {
+            for (int iapply = 0; iapply < napply; ++iapply) {
+                mlabec.Fsmooth(0, mglev, in, out, iapply%2);
+            }
+        });
+    }
+    return r;
+}
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc, argv);
+    {
+        int n_cell = 128;
+        int max_grid_size = 32;
+        int packed_stencil_level = 1;
+        int nsolves = 3;
+        int napply = 20;
+        int ntrials = 5;
+        int verbose = 1;
+        {
+            ParmParse pp;
+            pp.query("n_cell", n_cell);
+            pp.query("max_grid_size", max_grid_size);
+            pp.query("packed_stencil_level", packed_stencil_level);
+            pp.query("nsolves", nsolves);
+            pp.query("napply", napply);
+            pp.query("ntrials", ntrials);
+            pp.query("verbose", verbose);
+        }
+
+        Box domain(IntVect(0), IntVect(n_cell-1));
+        RealBox rb({AMREX_D_DECL(0.,0.,0.)}, {AMREX_D_DECL(1.,1.,1.)});
+        Geometry geom(domain, rb, CoordSys::cartesian, {AMREX_D_DECL(0,0,0)});
+        BoxArray ba(domain);
+        ba.maxSize(max_grid_size);
+        DistributionMapping dm(ba);
+
+        MultiFab rhs(ba, dm, 1, 0);
+        MultiFab acoef(ba, dm, 1, 0);
+        Array<MultiFab,AMREX_SPACEDIM> bcoef;
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            bcoef[idim].define(amrex::convert(ba, IntVect::TheDimensionVector(idim)), dm, 1, 0);
+        }
+
+        const auto dx = geom.CellSizeArray();
+        for (MFIter mfi(rhs); mfi.isValid(); ++mfi) {
+            auto const& r = rhs.array(mfi);
+            auto const& a = acoef.array(mfi);
+            amrex::ParallelFor(mfi.validbox(), [=] AMREX_GPU_DEVICE (int i, int j, int k)
+            {
+                Real x = (i+0.5)*dx[0];
+                Real y = (AMREX_SPACEDIM > 1) ? (j+0.5)*dx[1] : 0.5;
+                Real z = (AMREX_SPACEDIM > 2) ? (k+0.5)*dx[2] : 0.5;
+                r(i,j,k) = std::sin(Real(2.)*Math::pi<Real>()*x)
+                    *      std::cos(Real(2.)*Math::pi<Real>()*y)*z + Real(1.0);
+                a(i,j,k) = Real(1.0) + x*y;
+            });
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                auto const& b = bcoef[idim].array(mfi);
+                amrex::ParallelFor(mfi.nodaltilebox(idim),
+                [=] AMREX_GPU_DEVICE (int i, int j, int k)
+                {
+                    Real x = i*dx[0];
+                    Real z = (AMREX_SPACEDIM > 2) ? k*dx[2] : 0.5;
+                    b(i,j,k) = Real(1.0) + Real(0.5)*std::sin(Real(3.)*Math::pi<Real>()*x)*z;
+                });
+            }
+        }
+
+        MultiFab sol_ref(ba, dm, 1, 1);
+        MultiFab sol_packed(ba, dm, 1, 1);
+
+        auto r_ref = run(geom, ba, dm, acoef, bcoef, rhs, sol_ref, -1,
+                         nsolves, napply, ntrials, verbose);
+        auto r_packed = run(geom, ba, dm, acoef, bcoef, rhs, sol_packed, packed_stencil_level,
+                            nsolves, napply, ntrials, verbose);
+
+        amrex::Print() << "\nSolve time: original " << r_ref.solve_time
+                       << ", packed " << r_packed.solve_time << "\n"
+                       << "Fapply and Fsmooth times per level (original, packed):\n";
+        for (int mglev = 0; mglev < int(r_ref.apply_time.size()); ++mglev) {
+            amrex::Print() << "  level " << mglev << ": Fapply " << r_ref.apply_time[mglev]
+                           << "  " << r_packed.apply_time[mglev]
+                           << ", Fsmooth " << r_ref.smooth_time[mglev]
+                           << "  " << r_packed.smooth_time[mglev]
+                           << ((mglev >= packed_stencil_level && packed_stencil_level >= 0)
+                               ? "  (packed)\n" : "\n");
+        }
+
+        MultiFab::Subtract(sol_packed, sol_ref, 0, 0, 1, 0);
+        Real diff = sol_packed.norm0();
+        Real solmax = sol_ref.norm0();
+        amrex::Print() << "Max difference between solutions: " << diff
+                       << " (max solution " << solmax << ")\n";
+        AMREX_ALWAYS_ASSERT(diff <= Real(1.e-6)*solmax);
+    }
+    amrex::Finalize();
+}
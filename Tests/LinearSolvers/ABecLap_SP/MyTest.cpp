@@ -13,7 +13,9 @@ MyTest::MyTest ()
 void
 MyTest::solve ()
 {
-    if (prob_type == 1) {
+    if (mixed_precision) {
+        solveMixedPrecision();
+    } else if (prob_type == 1) {
         if (single_precision) {
             solvePoisson<fMultiFab>();
         } else {
@@ -30,6 +32,47 @@ MyTest::solve ()
     }
 }
 
+void
+MyTest::solveMixedPrecision ()
+{
+    LPInfo info;
+    info.setAgglomeration(agglomeration);
+    info.setConsolidation(consolidation);
+    info.setMaxCoarseningLevel(max_coarsening_level);
+
+    const Real tol_rel = 1.e-10;
+    const Real tol_abs = 0.0;
+
+    const auto nlevels = int(geom.size());
+
+    auto solve_levels = [&] (int lev_begin, int lev_end)
+    {
+        auto hi_linop = makeLinOp<MultiFab>(lev_begin, lev_end, info, false);
+        auto lo_linop = makeLinOp<fMultiFab>(lev_begin, lev_end, info, true);
+
+        MLMGMixedPrecision mlmg(*hi_linop, *lo_linop);
+        mlmg.setMaxIter(max_iter);
+        mlmg.setVerbose(verbose);
+        mlmg.getLowPrecisionMLMG().setBottomVerbose(bottom_verbose);
+
+        Vector<MultiFab*> sol;
+        Vector<MultiFab const*> b;
+        for (int ilev = lev_begin; ilev <= lev_end; ++ilev) {
+            sol.push_back(&solution[ilev]);
+            b.push_back(&rhs[ilev]);
+        }
+        mlmg.solve(sol, b, tol_rel, tol_abs);
+    };
+
+    if (composite_solve) {
+        solve_levels(0, nlevels-1);
+    } else {
+        for (int ilev = 0; ilev < nlevels; ++ilev) {
+            solve_levels(ilev, ilev);
+        }
+    }
+}
+
 void
 MyTest::readParameters ()
 {
@@ -44,6 +87,7 @@ MyTest::readParameters ()
     pp.query("prob_type", prob_type);
 
     pp.query("single_precision", single_precision);
+    pp.query("mixed_precision", mixed_precision);
 
     pp.query("verbose", verbose);
     pp.query("bottom_verbose", bottom_verbose);
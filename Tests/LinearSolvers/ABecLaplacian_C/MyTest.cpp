@@ -8,6 +8,8 @@
 #include <AMReX_ParmParse.H>
 #include <AMReX_MultiFabUtil.H>
 
+#include <numeric>
+
 #ifdef AMREX_USE_HYPRE
 #include <AMReX_HypreMLABecLap.H>
 #endif
@@ -22,6 +24,114 @@ MyTest::MyTest ()
 
 void
 MyTest::solve ()
+{
+    if (ref_bottom_solver.empty() && ref_fused_smoothing < 0) {
+        solveOnce();
+    } else {
+        solveAndCompareWithReference();
+    }
+}
+
+void
+MyTest::solveAndCompareWithReference ()
+{
+    const auto nlevels = static_cast<int>(geom.size());
+
+    // The initial solution holds the boundary values.
+    Vector<MultiFab> init_solution(nlevels);
+    for (int ilev = 0; ilev < nlevels; ++ilev) {
+        init_solution[ilev].define(solution[ilev].boxArray(), solution[ilev].DistributionMap(),
+                                   1, solution[ilev].nGrowVect());
+        MultiFab::Copy(init_solution[ilev], solution[ilev], 0, 0, 1, solution[ilev].nGrowVect());
+    }
+
+    const std::string bottom_solver_0 = bottom_solver;
+    const bool fused_smoothing_0 = fused_smoothing;
+    if (!ref_bottom_solver.empty()) { bottom_solver = ref_bottom_solver; }
+    if (ref_fused_smoothing >= 0) { fused_smoothing = ref_fused_smoothing; }
+
+    solveOnce();
+
+    auto const ref_niters = solve_niters;
+    auto const ref_nbottom_iters = solve_nbottom_iters;
+    auto const ref_resid = solve_resid;
+    Vector<MultiFab> ref_solution(nlevels);
+    for (int ilev = 0; ilev < nlevels; ++ilev) {
+        ref_solution[ilev].define(solution[ilev].boxArray(), solution[ilev].DistributionMap(), 1, 0);
+        MultiFab::Copy(ref_solution[ilev], solution[ilev], 0, 0, 1, 0);
+        MultiFab::Copy(solution[ilev], init_solution[ilev], 0, 0, 1, solution[ilev].nGrowVect());
+    }
+
+    bottom_solver = bottom_solver_0;
+    fused_smoothing = fused_smoothing_0;
+    solve_niters.clear();
+    solve_nbottom_iters.clear();
+    solve_resid.clear();
+
+    solveOnce();
+
+    AMREX_ALWAYS_ASSERT(solve_niters.size() == ref_niters.size());
+    bool pass = true;
+    for (int i = 0; i < solve_niters.size(); ++i) {
+        amrex::Print() << "Solve " << i << ": " << solve_niters[i] << " iterations ("
+                       << solve_nbottom_iters[i] << " bottom), residual " << solve_resid[i]
+                       << "; reference: " << ref_niters[i] << " iterations ("
+                       << ref_nbottom_iters[i] << " bottom), residual " << ref_resid[i] << '\n';
+        if (std::abs(solve_niters[i] - ref_niters[i]) > ref_max_iter_diff) { pass = false; }
+    }
+    for (int ilev = 0; ilev < nlevels; ++ilev) {
+        const Real ref_norm = ref_solution[ilev].norminf(0);
+        MultiFab::Subtract(ref_solution[ilev], solution[ilev], 0, 0, 1, 0);
+        const Real diff = ref_solution[ilev].norminf(0);
+        amrex::Print() << "Level " << ilev << ": max difference from reference solution "
+                       << diff << " (relative " << diff/ref_norm << ")\n";
+        if (diff > ref_sol_tol*ref_norm) { pass = false; }
+    }
+    if (!pass) {
+        amrex::Abort("The solve does not agree with the reference solve");
+    }
+}
+
+void
+MyTest::recordSolve (MLMG const& mlmg)
+{
+    solve_niters.push_back(mlmg.getNumIters());
+    auto const& ncg = mlmg.getNumCGIters();
+    solve_nbottom_iters.push_back(std::accumulate(ncg.begin(), ncg.end(), 0));
+    const Real rhsnorm = mlmg.getInitRHS();
+    solve_resid.push_back((rhsnorm > Real(0.0)) ? mlmg.getFinalResidual()/rhsnorm
+                                                : mlmg.getFinalResidual());
+}
+
+BottomSolver
+MyTest::bottomSolverType () const
+{
+    if (bottom_solver == "smoother") {
+        return BottomSolver::smoother;
+    } else if (bottom_solver == "bicgstab") {
+        return BottomSolver::bicgstab;
+    } else if (bottom_solver == "cg") {
+        return BottomSolver::cg;
+    } else if (bottom_solver == "bicgcg") {
+        return BottomSolver::bicgcg;
+    } else if (bottom_solver == "cgbicg") {
+        return BottomSolver::cgbicg;
+    } else if (bottom_solver == "amg") {
+        return BottomSolver::amg;
+    } else if (bottom_solver == "pipelined_cg") {
+        return BottomSolver::pipelined_cg;
+    } else if (bottom_solver == "pipelined_bicgstab") {
+        return BottomSolver::pipelined_bicgstab;
+    } else if (bottom_solver == "fft") {
+        return BottomSolver::fft;
+    } else {
+        amrex::Abort("Unknown bottom_solver "+bottom_solver);
+        return BottomSolver::Default;
+    }
+}
+
+void
+MyTest::solveOnce ()
 {
 #ifdef AMREX_USE_HYPRE
     if (use_mlhypre) {
@@ -53,6 +163,8 @@ MyTest::solvePoisson ()
     LPInfo info;
     info.setAgglomeration(agglomeration);
     info.setConsolidation(consolidation);
+    info.setFusedSmoothing(fused_smoothing);
+    info.setFusedSmoothingSweeps(fused_smoothing_sweeps);
     info.setMaxCoarseningLevel(max_coarsening_level);
 
     const auto tol_rel = Real(1.e-10);
@@ -86,6 +198,9 @@ MyTest::solvePoisson ()
         mlmg.setMaxFmgIter(max_fmg_iter);
         mlmg.setVerbose(verbose);
         mlmg.setBottomVerbose(bottom_verbose);
+        if (!bottom_solver.empty()) {
+            mlmg.setBottomSolver(bottomSolverType());
+        }
 #ifdef AMREX_USE_HYPRE
         if (use_hypre) {
             mlmg.setBottomSolver(MLMG::BottomSolver::hypre);
@@ -98,7 +213,14 @@ MyTest::solvePoisson ()
         }
 #endif
 
+        mlmg.setPerfReport(!perf_report_file.empty());
+
         mlmg.solve(GetVecOfPtrs(solution), GetVecOfConstPtrs(rhs), tol_rel, tol_abs);
+        recordSolve(mlmg);
+
+        if (!perf_report_file.empty()) {
+            mlmg.getPerfReport().writeJSON(perf_report_file);
+        }
     }
     else
     {
@@ -129,6 +251,9 @@ MyTest::solvePoisson ()
             mlmg.setMaxFmgIter(max_fmg_iter);
             mlmg.setVerbose(verbose);
             mlmg.setBottomVerbose(bottom_verbose);
+            if (!bottom_solver.empty()) {
+                mlmg.setBottomSolver(bottomSolverType());
+            }
 #ifdef AMREX_USE_HYPRE
             if (use_hypre) {
                 mlmg.setBottomSolver(MLMG::BottomSolver::hypre);
@@ -142,6 +267,7 @@ MyTest::solvePoisson ()
 #endif
 
             mlmg.solve({&solution[ilev]}, {&rhs[ilev]}, tol_rel, tol_abs);
+            recordSolve(mlmg);
         }
     }
 }
@@ -152,6 +278,8 @@ MyTest::solveABecLaplacian ()
     LPInfo info;
     info.setAgglomeration(agglomeration);
     info.setConsolidation(consolidation);
+    info.setFusedSmoothing(fused_smoothing);
+    info.setFusedSmoothingSweeps(fused_smoothing_sweeps);
     info.setSemicoarsening(semicoarsening);
     info.setMaxCoarseningLevel(max_coarsening_level);
     info.setMaxSemicoarseningLevel(max_semicoarsening_level);
@@ -205,6 +333,9 @@ MyTest::solveABecLaplacian ()
         mlmg.setMaxFmgIter(max_fmg_iter);
         mlmg.setVerbose(verbose);
         mlmg.setBottomVerbose(bottom_verbose);
+        if (!bottom_solver.empty()) {
+            mlmg.setBottomSolver(bottomSolverType());
+        }
 #ifdef AMREX_USE_HYPRE
         if (use_hypre) {
             mlmg.setBottomSolver(MLMG::BottomSolver::hypre);
@@ -217,7 +348,14 @@ MyTest::solveABecLaplacian ()
         }
 #endif
 
+        mlmg.setPerfReport(!perf_report_file.empty());
+
         mlmg.solve(GetVecOfPtrs(solution), GetVecOfConstPtrs(rhs), tol_rel, tol_abs);
+        recordSolve(mlmg);
+
+        if (!perf_report_file.empty()) {
+            mlmg.getPerfReport().writeJSON(perf_report_file);
+        }
     }
     else
     {
@@ -262,6 +400,9 @@ MyTest::solveABecLaplacian ()
             mlmg.setMaxFmgIter(max_fmg_iter);
             mlmg.setVerbose(verbose);
             mlmg.setBottomVerbose(bottom_verbose);
+            if (!bottom_solver.empty()) {
+                mlmg.setBottomSolver(bottomSolverType());
+            }
 #ifdef AMREX_USE_HYPRE
             if (use_hypre) {
                 mlmg.setBottomSolver(MLMG::BottomSolver::hypre);
@@ -275,6 +416,7 @@ MyTest::solveABecLaplacian ()
 #endif
 
             mlmg.solve({&solution[ilev]}, {&rhs[ilev]}, tol_rel, tol_abs);
+            recordSolve(mlmg);
         }
     }
 }
@@ -285,6 +427,8 @@ MyTest::solveABecLaplacianInhomNeumann ()
     LPInfo info;
     info.setAgglomeration(agglomeration);
     info.setConsolidation(consolidation);
+    info.setFusedSmoothing(fused_smoothing);
+    info.setFusedSmoothingSweeps(fused_smoothing_sweeps);
     info.setMaxCoarseningLevel(max_coarsening_level);
 
     const auto tol_rel = Real(1.e-10);
@@ -338,6 +482,9 @@ MyTest::solveABecLaplacianInhomNeumann ()
         mlmg.setMaxFmgIter(max_fmg_iter);
         mlmg.setVerbose(verbose);
         mlmg.setBottomVerbose(bottom_verbose);
+        if (!bottom_solver.empty()) {
+            mlmg.setBottomSolver(bottomSolverType());
+        }
 #ifdef AMREX_USE_HYPRE
         if (use_hypre) {
             mlmg.setBottomSolver(MLMG::BottomSolver::hypre);
@@ -351,6 +498,7 @@ MyTest::solveABecLaplacianInhomNeumann ()
 #endif
 
         mlmg.solve(GetVecOfPtrs(solution), GetVecOfConstPtrs(rhs), tol_rel, tol_abs);
+        recordSolve(mlmg);
     }
     else
     {
@@ -397,6 +545,9 @@ MyTest::solveABecLaplacianInhomNeumann ()
             mlmg.setMaxFmgIter(max_fmg_iter);
             mlmg.setVerbose(verbose);
             mlmg.setBottomVerbose(bottom_verbose);
+            if (!bottom_solver.empty()) {
+                mlmg.setBottomSolver(bottomSolverType());
+            }
 #ifdef AMREX_USE_HYPRE
             if (use_hypre) {
                 mlmg.setBottomSolver(MLMG::BottomSolver::hypre);
@@ -410,6 +561,7 @@ MyTest::solveABecLaplacianInhomNeumann ()
 #endif
 
             mlmg.solve({&solution[ilev]}, {&rhs[ilev]}, tol_rel, tol_abs);
+            recordSolve(mlmg);
         }
     }
 }
@@ -420,6 +572,8 @@ MyTest::solveNodeABecLaplacian ()
     LPInfo info;
     info.setAgglomeration(agglomeration);
     info.setConsolidation(consolidation);
+    info.setFusedSmoothing(fused_smoothing);
+    info.setFusedSmoothingSweeps(fused_smoothing_sweeps);
     info.setMaxCoarseningLevel(max_coarsening_level);
 
     const auto tol_rel = Real(1.e-10);
@@ -456,8 +610,12 @@ MyTest::solveNodeABecLaplacian ()
             mlmg.setMaxFmgIter(max_fmg_iter);
             mlmg.setVerbose(verbose);
             mlmg.setBottomVerbose(bottom_verbose);
+            if (!bottom_solver.empty()) {
+                mlmg.setBottomSolver(bottomSolverType());
+            }
 
             mlmg.solve({&solution[ilev]}, {&rhs[ilev]}, tol_rel, tol_abs);
+            recordSolve(mlmg);
         }
     }
 }
@@ -468,6 +626,8 @@ MyTest::solveABecLaplacianGMRES ()
     LPInfo info;
     info.setAgglomeration(agglomeration);
     info.setConsolidation(consolidation);
+    info.setFusedSmoothing(fused_smoothing);
+    info.setFusedSmoothingSweeps(fused_smoothing_sweeps);
     info.setSemicoarsening(semicoarsening);
     info.setMaxCoarseningLevel(max_coarsening_level);
     info.setMaxSemicoarseningLevel(max_semicoarsening_level);
@@ -555,11 +715,25 @@ MyTest::readParameters ()
     pp.query("agglomeration", agglomeration);
     pp.query("consolidation", consolidation);
     pp.query("semicoarsening", semicoarsening);
+    pp.query("fused_smoothing", fused_smoothing);
+    pp.query("fused_smoothing_sweeps", fused_smoothing_sweeps);
     pp.query("max_coarsening_level", max_coarsening_level);
     pp.query("max_semicoarsening_level", max_semicoarsening_level);
 
     pp.query("use_gauss_seidel", use_gauss_seidel);
 
+    pp.query("bottom_solver", bottom_solver);
+
+    pp.query("perf_report_file", perf_report_file);
+
+    {
+        ParmParse ppr("reference");
+        ppr.query("bottom_solver", ref_bottom_solver);
+        ppr.query("fused_smoothing", ref_fused_smoothing);
+        ppr.query("max_iter_diff", ref_max_iter_diff);
+        ppr.query("sol_tol", ref_sol_tol);
+    }
+
     pp.query("use_gmres", use_gmres);
     AMREX_ALWAYS_ASSERT(use_gmres == false || prob_type == 2);
 
@@ -0,0 +1,199 @@
+//
+// Benchmark of solving for multiple right-hand sides with one operator.
+// The right-hand sides are first solved one at a time, and then all at
+// once with an MLABecLaplacian that has one component per right-hand side
+// and shares the coefficients.  The batched solve uses the block CG bottom
+// solver by default.  The solutions must agree to the solver tolerance.
+// For both, the V-cycles, the bottom iterations, the coefficient data and
+// the ghost cell exchanges of the operator are reported.
+//
+
+#include <AMReX.H>
+#include <AMReX_MLABecLaplacian.H>
+#include <AMReX_MLMG.H>
+#include <AMReX_ParmParse.H>
+
+using namespace amrex;
+
+namespace {
+
+struct SolveStats
+{
+    Real time = 0.0;
+    int niters = 0;         // V-cycles
+    int nbottom_iters = 0;  // iterations of the bottom solver
+    Long coef_bytes = 0;    // a and b coefficients on the finest level
+    Long fb_messages = 0;   // ghost cell exchange messages of the operator
+    Long fb_bytes = 0;      // ghost cell exchange bytes of the operator
+
+    SolveStats& operator+= (SolveStats const& rhs) {
+        time += rhs.time;
+        niters += rhs.niters;
+        nbottom_iters += rhs.nbottom_iters;
+        coef_bytes += rhs.coef_bytes;
+        fb_messages += rhs.fb_messages;
+        fb_bytes += rhs.fb_bytes;
+        return *this;
+    }
+
+    void print (std::string const& name) const {
+        amrex::Print() << "  " << name << ": " << time << " s, "
+                       << niters << " V-cycles, " << nbottom_iters << " bottom iterations\n"
+                       << "    finest level coefficients: " << coef_bytes << " bytes\n"
+                       << "    ghost cell exchanges: " << fb_messages << " messages, "
+                       << fb_bytes << " bytes\n";
+    }
+};
+
+Long nbytes (MultiFab const& mf)
+{
+    return mf.boxArray().numPts() * mf.nComp() * Long(sizeof(Real));
+}
+
+SolveStats solve (Geometry const& geom, BoxArray const& ba, DistributionMapping const& dm,
+                  MultiFab const& acoef, Array<MultiFab,AMREX_SPACEDIM> const& bcoef,
+                  MultiFab const& rhs, MultiFab& sol, BottomSolver bottom_solver,
+                  bool shared_bcoef, int verbose, int bottom_verbose)
+{
+    const int ncomp = rhs.nComp();
+
+    MLABecLaplacian mlabec({geom}, {ba}, {dm}, LPInfo(), {}, ncomp);
+    if (shared_bcoef) { mlabec.setSharedBCoeffs(); }
+    mlabec.setDomainBC({AMREX_D_DECL(LinOpBCType::Dirichlet,
+                                     LinOpBCType::Dirichlet,
+                                     LinOpBCType::Dirichlet)},
+                       {AMREX_D_DECL(LinOpBCType::Dirichlet,
+                                     LinOpBCType::Dirichlet,
+                                     LinOpBCType::Dirichlet)});
+    mlabec.setLevelBC(0, nullptr);
+    mlabec.setScalars(1.0, 1.0);
+    mlabec.setACoeffs(0, acoef);
+    mlabec.setBCoeffs(0, amrex::GetArrOfConstPtrs(bcoef));
+
+    MLMG mlmg(mlabec);
+    mlmg.setVerbose(verbose);
+    mlmg.setBottomVerbose(bottom_verbose);
+    mlmg.setBottomSolver(bottom_solver);
+    mlmg.setPerfReport(true);
+
+    sol.setVal(0.0);
+    ParallelDescriptor::Barrier();
+    Real t0 = amrex::second();
+    mlmg.solve({&sol}, {&rhs}, 1.e-10, 0.0);
+    ParallelDescriptor::Barrier();
+
+    SolveStats stats;
+    stats.time = amrex::second() - t0;
+    stats.niters = mlmg.getNumIters();
+    for (int n : mlmg.getNumCGIters()) { stats.nbottom_iters += n; }
+    stats.coef_bytes = nbytes(*mlabec.getACoeffs(0,0));
+    for (auto const* b : mlabec.getBCoeffs(0,0)) { stats.coef_bytes += nbytes(*b); }
+    for (auto const& lev : mlmg.getPerfReport().levels) {
+        stats.fb_messages += lev.fb_messages;
+        stats.fb_bytes += lev.fb_bytes;
+    }
+    return stats;
+}
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc, argv);
+    {
+        int n_cell = 128;
+        int max_grid_size = 32;
+        int nrhs = 8;
+        std::string bottom_solver = "blockcg";
+        bool shared_bcoef = true;
+        int verbose = 1;
+        int bottom_verbose = 0;
+        {
+            ParmParse pp;
+            pp.query("n_cell", n_cell);
+            pp.query("max_grid_size", max_grid_size);
+            pp.query("nrhs", nrhs);
+            pp.query("bottom_solver", bottom_solver);
+            pp.query("shared_bcoef", shared_bcoef);
+            pp.query("verbose", verbose);
+            pp.query("bottom_verbose", bottom_verbose);
+        }
+
+        Box domain(IntVect(0), IntVect(n_cell-1));
+        RealBox rb({AMREX_D_DECL(0.,0.,0.)}, {AMREX_D_DECL(1.,1.,1.)});
+        Geometry geom(domain, rb, CoordSys::cartesian, {AMREX_D_DECL(0,0,0)});
+        BoxArray ba(domain);
+        ba.maxSize(max_grid_size);
+        DistributionMapping dm(ba);
+
+        MultiFab rhs(ba, dm, nrhs, 0);
+        MultiFab acoef(ba, dm, 1, 0);
+        Array<MultiFab,AMREX_SPACEDIM> bcoef;
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            bcoef[idim].define(amrex::convert(ba, IntVect::TheDimensionVector(idim)), dm, 1, 0);
+        }
+
+        const auto dx = geom.CellSizeArray();
+        for (MFIter mfi(rhs); mfi.isValid(); ++mfi) {
+            auto const& r = rhs.array(mfi);
+            auto const& a = acoef.array(mfi);
+            amrex::ParallelFor(mfi.validbox(), nrhs,
+            [=] AMREX_GPU_DEVICE (int i, int j, int k, int n)
+            {
+                Real x = (i+0.5)*dx[0];
+                Real y = (AMREX_SPACEDIM > 1) ? (j+0.5)*dx[1] : 0.5;
+                Real z = (AMREX_SPACEDIM > 2) ? (k+0.5)*dx[2] : 0.5;
+                r(i,j,k,n) = std::sin(Real(n+1)*Math::pi<Real>()*x)
+                    *        std::cos(Real(2.)*Math::pi<Real>()*y)*z + Real(n);
+                if (n == 0) {
+                    a(i,j,k) = Real(1.0) + x*y;
+                }
+            });
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                auto const& b = bcoef[idim].array(mfi);
+                amrex::ParallelFor(mfi.nodaltilebox(idim),
+                [=] AMREX_GPU_DEVICE (int i, int j, int k)
+                {
+                    Real x = i*dx[0];
+                    Real z = (AMREX_SPACEDIM > 2) ? k*dx[2] : 0.5;
+                    b(i,j,k) = Real(1.0) + Real(0.5)*std::sin(Real(3.)*Math::pi<Real>()*x)*z;
+                });
+            }
+        }
+
+        // One right-hand side at a time
+        MultiFab sol_ref(ba, dm, nrhs, 1);
+        SolveStats stats_ref;
+        {
+            MultiFab rhs1(ba, dm, 1, 0);
+            MultiFab sol1(ba, dm, 1, 1);
+            for (int n = 0; n < nrhs; ++n) {
+                MultiFab::Copy(rhs1, rhs, n, 0, 1, 0);
+                stats_ref += solve(geom, ba, dm, acoef, bcoef, rhs1, sol1, BottomSolver::cg,
+                                   false, verbose, bottom_verbose);
+                MultiFab::Copy(sol_ref, sol1, 0, n, 1, 0);
+            }
+        }
+
+        // All right-hand sides at once
+        MultiFab sol(ba, dm, nrhs, 1);
+        SolveStats stats = solve(geom, ba, dm, acoef, bcoef, rhs, sol,
+                                 (bottom_solver == "cg") ? BottomSolver::cg
+                                                         : BottomSolver::blockcg,
+                                 shared_bcoef, verbose, bottom_verbose);
+
+        amrex::Print() << "\n" << nrhs << " right-hand sides\n";
+        stats_ref.print("separate solves (in total)");
+        stats.print("batched solve with " + bottom_solver + " bottom");
+
+        Real diff = 0.0;
+        for (int n = 0; n < nrhs; ++n) {
+            MultiFab::Subtract(sol, sol_ref, n, n, 1, 0);
+            const Real d = sol.norm0(n) / sol_ref.norm0(n);
+            amrex::Print() << "  rhs " << n << ": relative difference " << d << "\n";
+            diff = std::max(diff, d);
+        }
+        AMREX_ALWAYS_ASSERT(diff <= Real(1.e-6));
+    }
+    amrex::Finalize();
+}
@@ -0,0 +1,165 @@
+#include <AMReX.H>
+#include <AMReX_MultiFab.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_ParticleInterpolators.H>
+#include <AMReX_ParticleMesh.H>
+#include <AMReX_Particles.H>
+
+using namespace amrex;
+
+// Compares the throughput of ParticleToMesh with thread-local scratch FABs
+// against the colored deposition directly into the target FAB, for CIC and
+// TSC shape functions.
+
+struct TestParams
+{
+    IntVect size{AMREX_D_DECL(64,64,64)};
+    int max_grid_size = 32;
+    int nppc = 8;
+    int nsteps = 10;
+    int sort_by_cell = 0;
+};
+
+using PC = ParticleContainer<1, 0>;
+
+template <typename F>
+double timeDeposition (PC const& pc, MultiFab& rho, bool colored, int nsteps, F const& f)
+{
+    PC::coloredDeposition = colored;
+    ParticleToMesh(pc, rho, 0, f); // warm up
+    Gpu::streamSynchronize();
+    ParallelDescriptor::Barrier();
+    auto t0 = amrex::second();
+    for (int step = 0; step < nsteps; ++step) {
+        ParticleToMesh(pc, rho, 0, f);
+    }
+    Gpu::streamSynchronize();
+    auto t = amrex::second() - t0;
+    ParallelDescriptor::ReduceRealMax(t);
+    return t;
+}
+
+template <typename F>
+void testDeposition (PC const& pc, MultiFab& rho, TestParams const& params,
+                     std::string const& name, F const& f)
+{
+    const bool colored_save = PC::coloredDeposition;
+
+    MultiFab rho_scratch(rho.boxArray(), rho.DistributionMap(), rho.nComp(), rho.nGrowVect());
+
+    auto t_scratch = timeDeposition(pc, rho_scratch, false, params.nsteps, f);
+    auto t_colored = timeDeposition(pc, rho, true, params.nsteps, f);
+
+    PC::coloredDeposition = colored_save;
+
+    const Real total = rho.sum(0);
+    MultiFab::Subtract(rho_scratch, rho, 0, 0, rho.nComp(), 0);
+    const Real diff = rho_scratch.norminf(0);
+    AMREX_ALWAYS_ASSERT(diff <= Real(1.e-10) * rho.norminf(0));
+
+    const auto np = double(pc.TotalNumberOfParticles()) * params.nsteps;
+    amrex::Print() << name << ": total charge " << total << ", max difference " << diff << "\n"
+                   << "  scratch FAB: " << t_scratch << " s, "
+                   << np/t_scratch << " particles/s\n"
+                   << "  colored    : " << t_colored << " s, "
+                   << np/t_colored << " particles/s, speedup "
+                   << t_scratch/t_colored << "\n";
+}
+
+void testParticleDeposition (TestParams const& params)
+{
+    RealBox real_box;
+    for (int n = 0; n < AMREX_SPACEDIM; n++) {
+        real_box.setLo(n, 0.0);
+        real_box.setHi(n, 1.0);
+    }
+
+    const Box domain(IntVect(0), params.size - 1);
+    Array<int,AMREX_SPACEDIM> is_per{AMREX_D_DECL(1,1,1)};
+    Geometry geom(domain, real_box, CoordSys::cartesian, is_per);
+
+    BoxArray ba(domain);
+    ba.maxSize(params.max_grid_size);
+    DistributionMapping dm(ba);
+
+    PC pc(geom, dm, ba);
+
+    const Long num_particles = Long(params.nppc) * domain.numPts();
+    PC::ParticleInitData pdata = {{1.0}, {}, {}, {}};
+    pc.InitRandom(num_particles, 451, pdata, false);
+
+    if (params.sort_by_cell) {
+        pc.SortParticlesByCell();
+    }
+
+    amrex::Print() << "Depositing " << pc.TotalNumberOfParticles() << " particles on "
+                   << ba.size() << " boxes, tiling = " << PC::do_tiling
+                   << ", tile size = " << PC::tile_size
+                   << ", sorted by cell = " << params.sort_by_cell << "\n";
+
+    const auto plo = geom.ProbLoArray();
+    const auto dxi = geom.InvCellSizeArray();
+
+    MultiFab rho(ba, dm, 1, 1);
+
+    testDeposition(pc, rho, params, "CIC",
+        [=] AMREX_GPU_DEVICE (const PC::ParticleType& p, Array4<Real> const& arr)
+        {
+            ParticleInterpolator::Linear interp(p, plo, dxi);
+            interp.ParticleToMesh(p, arr, 0, 0, 1,
+                [=] AMREX_GPU_DEVICE (const PC::ParticleType& part, int comp)
+                {
+                    return part.rdata(comp);
+                });
+        });
+
+    testDeposition(pc, rho, params, "TSC",
+        [=] AMREX_GPU_DEVICE (const PC::ParticleType& p, Array4<Real> const& arr)
+        {
+            Real w[AMREX_SPACEDIM][3];
+            int idx[AMREX_SPACEDIM];
+            for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                Real x = (p.pos(d) - plo[d]) * dxi[d];
+                idx[d] = static_cast<int>(amrex::Math::floor(x));
+                Real s = x - (Real(idx[d]) + Real(0.5));
+                w[d][0] = Real(0.5) * (Real(0.5) - s) * (Real(0.5) - s);
+                w[d][1] = Real(0.75) - s*s;
+                w[d][2] = Real(0.5) * (Real(0.5) + s) * (Real(0.5) + s);
+            }
+#if (AMREX_SPACEDIM == 1)
+            for (int ii = 0; ii < 3; ++ii) {
+                Gpu::Atomic::AddNoRet(&arr(idx[0]+ii-1,0,0), w[0][ii]*p.rdata(0));
+            }
+#elif (AMREX_SPACEDIM == 2)
+            for (int jj = 0; jj < 3; ++jj) {
+            for (int ii = 0; ii < 3; ++ii) {
+                Gpu::Atomic::AddNoRet(&arr(idx[0]+ii-1,idx[1]+jj-1,0),
+                                      w[0][ii]*w[1][jj]*p.rdata(0));
+            }}
+#else
+            for (int kk = 0; kk < 3; ++kk) {
+            for (int jj = 0; jj < 3; ++jj) {
+            for (int ii = 0; ii < 3; ++ii) {
+                Gpu::Atomic::AddNoRet(&arr(idx[0]+ii-1,idx[1]+jj-1,idx[2]+kk-1),
+                                      w[0][ii]*w[1][jj]*w[2][kk]*p.rdata(0));
+            }}}
+#endif
+        });
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+    {
+        ParmParse pp;
+        TestParams params;
+        pp.query("size", params.size);
+        pp.query("max_grid_size", params.max_grid_size);
+        pp.query("nppc", params.nppc);
+        pp.query("nsteps", params.nsteps);
+        pp.query("sort_by_cell", params.sort_by_cell);
+
+        testParticleDeposition(params);
+    }
+    amrex::Finalize();
+}
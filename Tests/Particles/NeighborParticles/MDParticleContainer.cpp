@@ -230,6 +230,36 @@ void MDParticleContainer::moveParticles(amrex::ParticleReal dx)
     }
 }
 
+void MDParticleContainer::moveParticlesApart(amrex::ParticleReal dx)
+{
+    BL_PROFILE("MDParticleContainer::moveParticlesApart");
+
+    const int lev = 0;
+    auto& plev  = GetParticles(lev);
+
+    for(MFIter mfi = MakeMFIter(lev); mfi.isValid(); ++mfi)
+    {
+        int gid = mfi.index();
+        int tid = mfi.LocalTileIndex();
+
+        auto& ptile = plev[std::make_pair(gid, tid)];
+        auto& aos   = ptile.GetArrayOfStructs();
+        ParticleType* pstruct = aos.data();
+
+        const size_t np = aos.numParticles();
+
+        // the particles with even and odd ids move in opposite directions
+        AMREX_FOR_1D ( np, i,
+        {
+            ParticleType& p = pstruct[i];
+            const ParticleReal d = (p.id() % 2 == 0) ? dx : -dx;
+            AMREX_D_TERM(p.pos(0) += d;,
+                         p.pos(1) += d;,
+                         p.pos(2) += d;)
+        });
+    }
+}
+
 void MDParticleContainer::writeParticles(int n)
 {
     BL_PROFILE("MDParticleContainer::writeParticles");
@@ -372,6 +402,173 @@ void MDParticleContainer::checkNeighborList()
     amrex::PrintToFile("neighbor_test") << "All the neighbor list particles match!" << '\n';
 }
 
+void MDParticleContainer::checkVerletNeighborList(amrex::ParticleReal cutoff)
+{
+    BL_PROFILE("MDParticleContainer::checkVerletNeighborList");
+
+    const int lev = 0;
+    auto& plev  = GetParticles(lev);
+
+    const ParticleReal cutoff_sq = cutoff*cutoff;
+
+    for (MFIter mfi = MakeMFIter(lev); mfi.isValid(); ++mfi)
+    {
+        int gid = mfi.index();
+
+        int tid = mfi.LocalTileIndex();
+        auto index = std::make_pair(gid, tid);
+
+        auto& ptile = plev[index];
+        auto& aos   = ptile.GetArrayOfStructs();
+
+        const int np       = aos.numParticles();
+        const int np_total = aos.numTotalParticles();
+
+        amrex::Gpu::HostVector<ParticleType> h_pstruct(np_total);
+        Gpu::copy(Gpu::deviceToHost, aos().dataPtr(), aos().dataPtr() + np_total, h_pstruct.begin());
+
+        // copy the (possibly reused) neighbor list to host
+        auto& d_counts = m_neighbor_list[lev][index].GetCounts();
+        Gpu::HostVector<unsigned int> h_counts(d_counts.size());
+        Gpu::copy(Gpu::deviceToHost, d_counts.begin(), d_counts.end(), h_counts.begin());
+
+        auto& d_list = m_neighbor_list[lev][index].GetList();
+        Gpu::HostVector<unsigned int> h_list(d_list.size());
+        Gpu::copy(Gpu::deviceToHost, d_list.begin(), d_list.end(), h_list.begin());
+
+        AMREX_ALWAYS_ASSERT(static_cast<int>(h_counts.size()) >= np);
+
+        // on the host, check with a full N^2 search that the list contains
+        // every pair within the cutoff at the current positions
+        unsigned start = 0;
+        for (int i = 0; i < np; i++)
+        {
+            std::sort(h_list.data() + start, h_list.data() + start + h_counts[i]);
+
+            ParticleType& p1 = h_pstruct[i];
+
+            for (int j = 0; j < np_total; j++)
+            {
+                if ( i == j ) { continue; }
+
+                ParticleType& p2 = h_pstruct[j];
+                AMREX_D_TERM(Real dx = p1.pos(0) - p2.pos(0);,
+                             Real dy = p1.pos(1) - p2.pos(1);,
+                             Real dz = p1.pos(2) - p2.pos(2);)
+
+                Real r2 = AMREX_D_TERM(dx*dx, + dy*dy, + dz*dz);
+
+                if (r2 <= cutoff_sq)
+                {
+                    AMREX_ALWAYS_ASSERT(std::binary_search(h_list.data() + start,
+                                                           h_list.data() + start + h_counts[i],
+                                                           static_cast<unsigned int>(j)));
+                }
+            }
+
+            start += h_counts[i];
+        }
+    }
+
+    amrex::PrintToFile("neighbor_test") << "All the pairs within the cutoff are in the Verlet list!" << '\n';
+}
+
+void MDParticleContainer::checkHalfAndClusterLists()
+{
+    BL_PROFILE("MDParticleContainer::checkHalfAndClusterLists");
+
+    const int lev = 0;
+    const auto& geom = Geom(lev);
+    auto& plev  = GetParticles(lev);
+
+    const ParticleReal cutoff = 5.0*Params::cutoff;
+    const ParticleReal cutoff_sq = cutoff*cutoff;
+
+    for (MFIter mfi = MakeMFIter(lev); mfi.isValid(); ++mfi)
+    {
+        auto index = std::make_pair(mfi.index(), mfi.LocalTileIndex());
+        auto& ptile = plev[index];
+        auto& aos   = ptile.GetArrayOfStructs();
+
+        const int np       = aos.numParticles();
+        const int np_total = aos.numTotalParticles();
+        const ParticleType* pstruct = aos().dataPtr();
+
+        amrex::Gpu::HostVector<ParticleType> h_pstruct(np_total);
+        Gpu::copy(Gpu::deviceToHost, pstruct, pstruct + np_total, h_pstruct.begin());
+
+        // on the host, count the neighbors of each particle with a full N^2 search
+        amrex::Vector<int> full_count(np, 0);
+        for (int i = 0; i < np; i++) {
+            for (int j = 0; j < np_total; j++) {
+                if (i != j && CheckPair()(h_pstruct[i], h_pstruct[j])) { full_count[i] += 1; }
+            }
+        }
+
+        Box bx = mfi.tilebox();
+        bx.grow(m_num_neighbor_cells);
+
+        auto check_counts = [&] (Gpu::DeviceVector<int> const& d_count, const char* name)
+        {
+            Gpu::HostVector<int> h_count(d_count.size());
+            Gpu::copy(Gpu::deviceToHost, d_count.begin(), d_count.end(), h_count.begin());
+            for (int i = 0; i < np; ++i) {
+                if (h_count[i] != full_count[i]) {
+                    amrex::Abort(std::string("Wrong neighbor count with ") + name);
+                }
+            }
+        };
+
+        // Half list: each pair is stored once, so count it for both particles.
+        {
+            AMREX_ALWAYS_ASSERT(halfNeighborList());
+            auto nbor_data = m_neighbor_list[lev][index].data();
+
+            Gpu::DeviceVector<int> d_count(np, 0);
+            auto* pcount = d_count.dataPtr();
+            amrex::ParallelFor(np, [=] AMREX_GPU_DEVICE (int i) noexcept
+            {
+                for (auto it = nbor_data.getNeighbors(i).begin();
+                     it != nbor_data.getNeighbors(i).end(); ++it)
+                {
+                    const int j = int(it.index());
+                    AMREX_ASSERT(j > i);
+                    Gpu::Atomic::AddNoRet(&pcount[i], 1);
+                    if (j < np) { Gpu::Atomic::AddNoRet(&pcount[j], 1); }
+                }
+            });
+            check_counts(d_count, "half neighbor list");
+        }
+
+        // Cluster pair lists, with full and half lists
+        for (int half = 0; half < 2; ++half)
+        {
+            ClusterPairList<ParticleType, 4> cluster_list;
+            cluster_list.build(ptile, bx, geom, cutoff, m_num_neighbor_cells, half);
+            auto cluster_data = cluster_list.data();
+
+            Gpu::DeviceVector<int> d_count(np, 0);
+            auto* pcount = d_count.dataPtr();
+            amrex::ParallelFor(cluster_list.numClusters(), [=] AMREX_GPU_DEVICE (int ci) noexcept
+            {
+                cluster_data.forEachPair(ci, [&] (int i, int j)
+                {
+                    AMREX_D_TERM(ParticleReal dx = pstruct[i].pos(0) - pstruct[j].pos(0);,
+                                 ParticleReal dy = pstruct[i].pos(1) - pstruct[j].pos(1);,
+                                 ParticleReal dz = pstruct[i].pos(2) - pstruct[j].pos(2);)
+                    ParticleReal r2 = AMREX_D_TERM(dx*dx, + dy*dy, + dz*dz);
+                    if (r2 > cutoff_sq) { return; }
+                    if (i < np) { Gpu::Atomic::AddNoRet(&pcount[i], 1); }
+                    if (half && j < np) { Gpu::Atomic::AddNoRet(&pcount[j], 1); }
+                });
+            });
+            check_counts(d_count, half ? "half cluster pair list" : "cluster pair list");
+        }
+    }
+
+    amrex::PrintToFile("neighbor_test") << "The half and cluster pair lists match!" << '\n';
+}
+
 void MDParticleContainer::reset_test_id()
 {
     BL_PROFILE("MDParticleContainer::reset_test_id");
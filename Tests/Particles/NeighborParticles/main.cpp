@@ -7,6 +7,7 @@
 
 #include "MDParticleContainer.H"
 
+#include <cmath>
 #include <string>
 
 using namespace amrex;
@@ -25,6 +26,10 @@ void testNeighborParticles();
 
 void testNeighborList();
 
+void testVerletNeighborList();
+
+void testHalfAndClusterLists();
+
 int main (int argc, char* argv[])
 {
     amrex::Initialize(argc,argv);
@@ -35,6 +40,12 @@ int main (int argc, char* argv[])
     amrex::PrintToFile("neighbor_test") << "Running neighbor list test \n";
     testNeighborList();
 
+    amrex::PrintToFile("neighbor_test") << "Running Verlet neighbor list test \n";
+    testVerletNeighborList();
+
+    amrex::PrintToFile("neighbor_test") << "Running half and cluster pair list test \n";
+    testHalfAndClusterLists();
+
     amrex::Finalize();
 }
 
@@ -220,3 +231,117 @@ void testNeighborList ()
         pc.WritePlotFile("NeighborParticles_plt00001", "neighbors");
     }
 }
+
+void testVerletNeighborList ()
+{
+    BL_PROFILE("testVerletNeighborList");
+    TestParams params;
+    get_test_params(params, "nbor_parts");
+
+    RealBox real_box;
+    for (int n = 0; n < BL_SPACEDIM; n++)
+    {
+        real_box.setLo(n, 0.0);
+        real_box.setHi(n, params.size[n]);
+    }
+
+    IntVect domain_lo(AMREX_D_DECL(0, 0, 0));
+    IntVect domain_hi(AMREX_D_DECL(params.size[0]-1,params.size[1]-1,params.size[2]-1));
+    const Box domain(domain_lo, domain_hi);
+
+    int coord = 0;
+    int is_per[] = {AMREX_D_DECL(params.is_periodic,
+                                 params.is_periodic,
+                                 params.is_periodic)};
+    Geometry geom(domain, &real_box, coord, is_per);
+
+    BoxArray ba(domain);
+    ba.maxSize(params.max_grid_size);
+    DistributionMapping dm(ba);
+
+    // Pairs within the cutoff are needed at every step, so the lists are
+    // built with cutoff+skin, and the neighbor cells have to cover that.
+    const auto cutoff = ParticleReal(1.2);
+    const auto skin   = ParticleReal(0.5);
+    const int ncells = static_cast<int>(std::ceil(cutoff + skin));
+    MDParticleContainer pc(geom, dm, ba, ncells);
+
+    IntVect nppc(params.num_ppc);
+    pc.InitParticles(nppc, 1.0, 0.0);
+
+    // The lists are reused until a particle has moved more than skin/2
+    pc.setVerletSkin(skin);
+
+    const VerletCheckPair check_pair{cutoff + skin};
+
+    AMREX_ALWAYS_ASSERT(pc.updateVerletNeighborList(check_pair));
+
+    // Each step moves every particle by sqrt(AMREX_SPACEDIM)*dx, in opposite
+    // directions for even and odd ids, so that pairs from outside the cutoff
+    // come inside it while the lists are reused.
+    const auto dx = static_cast<amrex::ParticleReal>(0.02);
+    const int nsteps_per_rebuild = static_cast<int>(
+        std::ceil(Real(0.5)*skin/(std::sqrt(Real(AMREX_SPACEDIM))*dx)));
+
+    int num_rebuilds = 0;
+    const int nsteps = 3*nsteps_per_rebuild;
+    for (int step = 1; step <= nsteps; ++step)
+    {
+        pc.moveParticlesApart(dx);
+        bool rebuilt = pc.updateVerletNeighborList(check_pair);
+        if (rebuilt) { ++num_rebuilds; }
+
+        amrex::PrintToFile("neighbor_test") << "Step " << step << ": rebuilt = " << rebuilt << "\n";
+
+        AMREX_ALWAYS_ASSERT(rebuilt == (step % nsteps_per_rebuild == 0));
+
+        if (params.check_answer) {
+            pc.checkVerletNeighborList(cutoff);
+        }
+    }
+
+    AMREX_ALWAYS_ASSERT(num_rebuilds == 3);
+}
+
+void testHalfAndClusterLists ()
+{
+    BL_PROFILE("testHalfAndClusterLists");
+    TestParams params;
+    get_test_params(params, "cluster_list");
+
+    RealBox real_box;
+    for (int n = 0; n < BL_SPACEDIM; n++)
+    {
+        real_box.setLo(n, 0.0);
+        real_box.setHi(n, params.size[n]);
+    }
+
+    IntVect domain_lo(AMREX_D_DECL(0, 0, 0));
+    IntVect domain_hi(AMREX_D_DECL(params.size[0]-1,params.size[1]-1,params.size[2]-1));
+    const Box domain(domain_lo, domain_hi);
+
+    int coord = 0;
+    int is_per[] = {AMREX_D_DECL(params.is_periodic,
+                                 params.is_periodic,
+                                 params.is_periodic)};
+    Geometry geom(domain, &real_box, coord, is_per);
+
+    BoxArray ba(domain);
+    ba.maxSize(params.max_grid_size);
+    DistributionMapping dm(ba);
+
+    const int ncells = 1;
+    MDParticleContainer pc(geom, dm, ba, ncells);
+
+    IntVect nppc(params.num_ppc);
+    pc.InitParticles(nppc, 1.0, 0.0);
+
+    // store the particles in cell order, so that the clusters are contiguous
+    pc.SortParticlesByCell();
+    pc.fillNeighbors();
+
+    pc.setHalfNeighborList(true);
+    pc.buildNeighborList(CheckPair());
+
+    pc.checkHalfAndClusterLists();
+}
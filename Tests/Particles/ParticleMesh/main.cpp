@@ -153,6 +153,131 @@ void testParticleMesh (TestParams& parms)
   myPC.WritePlotFile("plot", "particle0");
 }
 
+// Checks that MeshToParticleToMesh gives the same result as MeshToParticle,
+// a separate push and ParticleToMesh.
+void testFusedParticleMesh (TestParams& parms)
+{
+  RealBox real_box;
+  for (int n = 0; n < AMREX_SPACEDIM; n++) {
+    real_box.setLo(n, 0.0);
+    real_box.setHi(n, 1.0);
+  }
+
+  IntVect domain_lo(AMREX_D_DECL(0, 0, 0));
+  IntVect domain_hi(AMREX_D_DECL(parms.nx - 1, parms.ny - 1, parms.nz-1));
+  const Box domain(domain_lo, domain_hi);
+
+  int is_per[] = {AMREX_D_DECL(1,1,1)};
+  Geometry geom(domain, &real_box, CoordSys::cartesian, is_per);
+
+  BoxArray ba(domain);
+  ba.maxSize(parms.max_grid_size);
+  DistributionMapping dmap(ba);
+
+  using MyParticleContainer = ParticleContainer<1 + 2*AMREX_SPACEDIM, 1>;
+  using PType = MyParticleContainer::ParticleType;
+  MyParticleContainer separatePC(geom, dmap, ba);
+  MyParticleContainer fusedPC(geom, dmap, ba);
+
+  // one particle per cell is enough here
+  int num_particles = parms.nx * parms.ny * parms.nz;
+  double mass = 10.0;
+  MyParticleContainer::ParticleInitData pdata = {{mass, AMREX_D_DECL(1.0, 2.0, 3.0), AMREX_D_DECL(0.0, 0.0, 0.0)}, {},{},{}};
+  separatePC.InitRandom(num_particles, 451, pdata, true);
+  fusedPC.InitRandom(num_particles, 451, pdata, true);
+
+  MultiFab efield(ba, dmap, AMREX_SPACEDIM, 1);
+  for (MFIter mfi(efield); mfi.isValid(); ++mfi) {
+    auto const& arr = efield.array(mfi);
+    amrex::ParallelFor(mfi.fabbox(), AMREX_SPACEDIM,
+    [=] AMREX_GPU_DEVICE (int i, int j, int k, int n) noexcept
+    {
+      arr(i,j,k,n) = Real(1.0) + Real(0.01)*(i + 2*j + 3*k) + n;
+    });
+  }
+
+  const auto plo = geom.ProbLoArray();
+  const auto dxi = geom.InvCellSizeArray();
+  const ParticleReal dt = ParticleReal(0.1)/(3*parms.nx);
+
+  auto gather = [=] AMREX_GPU_DEVICE (PType& p, amrex::Array4<const amrex::Real> const& e)
+  {
+      ParticleInterpolator::Linear interp(p, plo, dxi);
+      interp.MeshToParticle(p, e, 0, 1+AMREX_SPACEDIM, AMREX_SPACEDIM,
+              [=] AMREX_GPU_DEVICE (amrex::Array4<const amrex::Real> const& arr,
+                                    int i, int j, int k, int comp)
+              {
+                  return arr(i, j, k, comp);
+              },
+              [=] AMREX_GPU_DEVICE (PType& part, int comp, amrex::Real val)
+              {
+                  part.rdata(comp) = ParticleReal(val);
+              });
+  };
+
+  auto push = [=] AMREX_GPU_DEVICE (PType& p)
+  {
+      for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+          p.rdata(1+d) += dt*p.rdata(1+AMREX_SPACEDIM+d);
+          p.pos(d) += dt*p.rdata(1+d);
+      }
+  };
+
+  auto deposit = [=] AMREX_GPU_DEVICE (const PType& p, amrex::Array4<amrex::Real> const& rho)
+  {
+      ParticleInterpolator::Linear interp(p, plo, dxi);
+      interp.ParticleToMesh(p, rho, 0, 0, 1,
+              [=] AMREX_GPU_DEVICE (const PType& part, int comp)
+              {
+                  return part.rdata(comp);
+              });
+  };
+
+  MultiFab separateMF(ba, dmap, 1, 1);
+  amrex::MeshToParticle(separatePC, efield, 0,
+      [=] AMREX_GPU_DEVICE (PType& p, amrex::Array4<const amrex::Real> const& e)
+      {
+          gather(p, e);
+      });
+  for (MyParticleContainer::ParIterType pti(separatePC, 0); pti.isValid(); ++pti) {
+    auto* pstruct = pti.GetArrayOfStructs()().dataPtr();
+    amrex::ParallelFor(pti.numParticles(), [=] AMREX_GPU_DEVICE (int i) noexcept
+    {
+        push(pstruct[i]);
+    });
+  }
+  amrex::ParticleToMesh(separatePC, separateMF, 0,
+      [=] AMREX_GPU_DEVICE (const PType& p, amrex::Array4<amrex::Real> const& rho)
+      {
+          deposit(p, rho);
+      });
+
+  MultiFab fusedMF(ba, dmap, 1, 1);
+  amrex::MeshToParticleToMesh(fusedPC, efield, fusedMF, 0,
+      [=] AMREX_GPU_DEVICE (PType& p, amrex::Array4<const amrex::Real> const& e,
+                            amrex::Array4<amrex::Real> const& rho)
+      {
+          gather(p, e);
+          push(p);
+          deposit(p, rho);
+      });
+
+  MultiFab::Subtract(fusedMF, separateMF, 0, 0, 1, 0);
+  const Real diff = fusedMF.norm0(0);
+  const Real total = separateMF.norm0(0);
+  if (ParallelDescriptor::IOProcessor()) {
+    std::cout << "Fused deposition differs by " << diff << " out of " << total << '\n';
+  }
+  AMREX_ALWAYS_ASSERT(diff <= 1.e-12*total);
+
+  for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+    auto sum_pos = [=] AMREX_GPU_HOST_DEVICE (const PType& p) -> Real { return p.pos(d); };
+    const Real separate_sum = amrex::ReduceSum(separatePC, sum_pos);
+    const Real fused_sum = amrex::ReduceSum(fusedPC, sum_pos);
+    AMREX_ALWAYS_ASSERT(separate_sum == fused_sum);
+  }
+}
+
 int main(int argc, char* argv[])
 {
   amrex::Initialize(argc,argv);
@@ -183,5 +308,7 @@ int main(int argc, char* argv[])
 
   testParticleMesh(parms);
 
+  testFusedParticleMesh(parms);
+
   amrex::Finalize();
 }
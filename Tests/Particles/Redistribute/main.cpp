@@ -313,6 +313,32 @@ public:
             }
         }
     }
+
+    void checkSorted () const
+    {
+        BL_PROFILE("TestParticleContainer::checkSorted");
+
+        for (int lev = 0; lev <= finestLevel(); ++lev)
+        {
+            const auto& geom = Geom(lev);
+            const auto& plev  = GetParticles(lev);
+            for(MFIter mfi = MakeMFIter(lev); mfi.isValid(); ++mfi)
+            {
+                const auto& ptile = plev.at(std::make_pair(mfi.index(), mfi.LocalTileIndex()));
+                const auto& ptd = ptile.getConstParticleTileData();
+                const int np = ptile.numParticles();
+
+                const GetParticleBin get_bin{geom.ProbLoArray(), geom.InvCellSizeArray(),
+                                             geom.Domain(), IntVect(1), mfi.validbox()};
+                AMREX_FOR_1D ( np, i,
+                {
+                    if (i > 0) {
+                        AMREX_ALWAYS_ASSERT(get_bin(ptd.m_aos[i-1]) <= get_bin(ptd.m_aos[i]));
+                    }
+                });
+            }
+        }
+    }
 };
 
 struct TestParams
@@ -329,6 +355,9 @@ struct TestParams
     int sort;
     int test_level_lost = 0;
     int stable_redistribute = 0;
+    int incremental_redistribute = 0;
+    int load_balance = 0;
+    int incremental_sort = 0;
 };
 
 void testRedistribute();
@@ -360,9 +389,12 @@ void get_test_params(TestParams& params, const std::string& prefix)
     pp.query("num_runtime_int", num_runtime_int);
     pp.query("remove_negative", remove_negative);
     pp.query("stable_redistribute", params.stable_redistribute);
+    pp.query("incremental_redistribute", params.incremental_redistribute);
+    pp.query("load_balance", params.load_balance);
 
     params.sort = 0;
     pp.query("sort", params.sort);
+    pp.query("incremental_sort", params.incremental_sort);
 }
 
 void testRedistribute ()
@@ -413,6 +445,8 @@ void testRedistribute ()
 
     TestParticleContainer pc(geom, dm, ba, rr);
     pc.setStableRedistribute(params.stable_redistribute);
+    pc.setIncrementalRedistribute(params.incremental_redistribute);
+    pc.setIncrementalSort(params.incremental_sort);
 
     IntVect nppc(params.num_ppc);
 
@@ -424,7 +458,10 @@ void testRedistribute ()
 
     auto np_old = pc.TotalNumberOfParticles();
 
-    if (params.sort) { pc.SortParticlesByCell(); }
+    if (params.sort) {
+        pc.SortParticlesByCell();
+        pc.checkSorted();
+    }
 
     for (int i = 0; i < params.nsteps; ++i)
     {
@@ -437,7 +474,10 @@ void testRedistribute ()
             pc.negateEven();
         }
         pc.RedistributeLocal();
-        if (params.sort) { pc.SortParticlesByCell(); }
+        if (params.sort) {
+            pc.SortParticlesByCell();
+            pc.checkSorted();
+        }
         pc.checkAnswer();
     }
 
@@ -484,6 +524,32 @@ void testRedistribute ()
             pc.checkAnswer();
         }
 
+        if (params.load_balance)
+        {
+            // make the grids owned by proc 0 expensive, so that the level is imbalanced
+            for (int lev = 0; lev < params.nlevs; ++lev)
+            {
+                LayoutData<Real> measured(pc.ParticleBoxArray(lev),
+                                          pc.ParticleDistributionMap(lev));
+                for (MFIter mfi(measured); mfi.isValid(); ++mfi) {
+                    measured[mfi] = (ParallelDescriptor::MyProc() == 0) ? 1.e6_rt : 0.0_rt;
+                }
+                auto costs = pc.LoadBalanceCosts(lev, 1.0_rt, 0.0_rt, &measured);
+
+                auto np_before = pc.TotalNumberOfParticles();
+                DistributionMapping new_dm;
+                bool rebalanced = pc.LoadBalance(lev, costs, 1.1_rt, new_dm);
+                if (NProcs > 1 && ba[lev].size() > NProcs) {
+                    AMREX_ALWAYS_ASSERT(rebalanced);
+                }
+                if (rebalanced) {
+                    AMREX_ALWAYS_ASSERT(new_dm == pc.ParticleDistributionMap(lev));
+                }
+                AMREX_ALWAYS_ASSERT(np_before == pc.TotalNumberOfParticles());
+                pc.checkAnswer();
+            }
+        }
+
         if (params.test_level_lost) {
             AMREX_ALWAYS_ASSERT(params.nlevs > 2);
             auto np_before_level_lost = pc.TotalNumberOfParticles();
@@ -8,6 +8,9 @@
 #include <AMReX_GpuContainers.H>
 
 #include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
 
 using namespace amrex;
 
@@ -175,14 +178,86 @@ void addParticles ()
     */
 }
 
+template <typename T_PC, typename T>
+void testCompactPositions ()
+{
+    int is_per[AMREX_SPACEDIM];
+    for (int & d : is_per) {
+        d = 1;
+    }
+
+    RealBox real_box;
+    for (int n = 0; n < AMREX_SPACEDIM; n++)
+    {
+        real_box.setLo(n, 0.0);
+        real_box.setHi(n, 100.0);
+    }
+
+    const Box base_domain(IntVect(0), IntVect(127));
+    Geometry geom(base_domain, &real_box, CoordSys::cartesian, is_per);
+    BoxArray ba(base_domain);
+    ba.maxSize(64);
+    DistributionMapping dm(ba);
+
+    T_PC pc(geom, dm, ba);
 
+    typename T_PC::ParticleInitData pdata = {{}, {}, {}, {}};
+    pc.InitRandom(10000, 451, pdata, false);
 
+    const auto np = pc.TotalNumberOfParticles();
+    const ParticleReal shift = 0.1_prt;
+
+    // the positions are pushed through the compact ParticleTileData,
+    // and must come back within the quantization error
+    using PTDType = typename T_PC::ParticleTileType::ConstParticleTileDataType;
+    auto sum_pos = [&] () {
+        auto sm = amrex::ReduceSum(pc, [=] AMREX_GPU_HOST_DEVICE (const PTDType& ptd, const int i) -> ParticleReal
+                                   {
+                                       return AMREX_D_TERM(ptd.pos(0, i), + ptd.pos(1, i), + ptd.pos(2, i));
+                                   });
+        ParallelDescriptor::ReduceRealSum(sm);
+        return sm;
+    };
+    const ParticleReal sum_before = sum_pos();
+
+    pc.template CompactPositions<T>();
+    AMREX_ALWAYS_ASSERT(np == 0 || pc.HasCompactPositions());
+
+    for (typename T_PC::ParIterType pti(pc, 0); pti.isValid(); ++pti)
+    {
+        auto cptd = pti.GetParticleTile().template getCompactParticleTileData<T>();
+        ParallelFor(pti.numParticles(), [=] AMREX_GPU_DEVICE (int i)
+        {
+            for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                cptd.pos(d, i) += shift;
+            }
+            cptd.rdata(AMREX_SPACEDIM)[i] = cptd.getPos(0, i);
+        });
+    }
+
+    pc.ExpandPositions();
+    AMREX_ALWAYS_ASSERT(!pc.HasCompactPositions());
+
+    // tile boxes are at most 64+2 cells wide
+    const ParticleReal tol = 2._prt * 66._prt * ParticleReal(geom.CellSize(0))
+        / (static_cast<ParticleReal>(std::numeric_limits<T>::max()) + 1._prt);
+    const ParticleReal sum_after = sum_pos();
+    const ParticleReal expected = sum_before + AMREX_SPACEDIM*shift*static_cast<ParticleReal>(np);
+    amrex::Print() << "compact positions with " << 8*sizeof(T) << " bits, error per particle: "
+                   << std::abs(sum_after - expected)/static_cast<ParticleReal>(np) << "\n";
+    AMREX_ALWAYS_ASSERT(std::abs(sum_after - expected) <= AMREX_SPACEDIM*tol*static_cast<ParticleReal>(np));
+
+    pc.Redistribute();
+    AMREX_ALWAYS_ASSERT(pc.TotalNumberOfParticles() == np);
+}
 
 int main(int argc, char* argv[])
  {
     amrex::Initialize(argc,argv);
     {
         addParticles< ParticleContainerPureSoA<4, 2> > ();
+        testCompactPositions< ParticleContainerPureSoA<4, 2>, std::uint16_t > ();
+        testCompactPositions< ParticleContainerPureSoA<4, 2>, std::uint32_t > ();
     }
     amrex::Finalize();
  }